@@ -34,6 +34,57 @@
  #define HOT_ 
 #endif /* HOT */
 
+/* Store a tick as a time stamp (its low 16 bits in compact-state mode) */
+#define SIMPLEBTN_STAMP(tick)           ((simpleButton_Type_TimeStamp_t)(tick))
+
+/* Ticks elapsed since a time stamp that is not newer than `now` */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_Since(const uint32_t now, const simpleButton_Type_TimeStamp_t stamp) {
+    return (uint32_t)(simpleButton_Type_TimeStamp_t)(SIMPLEBTN_STAMP(now) - stamp);
+}
+
+/* Ticks elapsed since a time stamp that may be newer than `now` (negative then) */
+SIMPLEBTN_FORCE_INLINE int32_t
+simpleButton_Private_SignedSince(const uint32_t now, const simpleButton_Type_TimeStamp_t stamp) {
+#if SIMPLEBTN_MODE_ENABLE_COMPACT_STATE == 0
+    return (int32_t)(now - stamp);
+#else
+    return (int32_t)(int16_t)(uint16_t)(SIMPLEBTN_STAMP(now) - stamp);
+#endif /* SIMPLEBTN_MODE_ENABLE_COMPACT_STATE == 0 */
+}
+
+/* The full tick of a time stamp that is not newer than `now` */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_StampTick(const uint32_t now, const simpleButton_Type_TimeStamp_t stamp) {
+    return now - simpleButton_Private_Since(now, stamp);
+}
+
+/* Record the push moment (EXTI or polling) */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_StampPush(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint32_t tick
+) {
+    self_private->timeStamp_interrupt = SIMPLEBTN_STAMP(tick);
+#if SIMPLEBTN_MODE_ENABLE_COMPACT_STATE != 0
+    self_private->epoch = 0;
+#endif /* SIMPLEBTN_MODE_ENABLE_COMPACT_STATE != 0 */
+}
+
+/* Ticks elapsed since the push */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_PushedFor(
+    const simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint32_t now
+) {
+#if SIMPLEBTN_MODE_ENABLE_COMPACT_STATE == 0
+    return now - self_private->timeStamp_interrupt;
+#else
+    return ((uint32_t)self_private->epoch * SIMPLEBTN_COMPACT_EPOCH_TICKS)
+        + simpleButton_Private_Since(now, self_private->timeStamp_interrupt);
+#endif /* SIMPLEBTN_MODE_ENABLE_COMPACT_STATE == 0 */
+}
+
 SIMPLEBTN_C_API void simpleButton_Private_InitStructPublic(
     simpleButton_Type_PublicBtnStatus_t* self_public
 ) {
@@ -54,6 +105,15 @@ SIMPLEBTN_C_API void simpleButton_Private_InitStructPublic(
     self_public->combinationConfig.callBack = 0;
 #endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
 
+#if SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0
+    self_public->pressCallBack = 0;
+    self_public->releaseCallBack = 0;
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_PROFILING != 0
+    SimpleButton_Profile_Clear(&(self_public->profile));
+#endif /* SIMPLEBTN_MODE_ENABLE_PROFILING != 0 */
+
 }
 
 SIMPLEBTN_C_API void simpleButton_Private_InitStructPrivate(
@@ -62,8 +122,16 @@ SIMPLEBTN_C_API void simpleButton_Private_InitStructPrivate(
     /* Initialize the member variables and method */
     self_private->push_time = 0;
     self_private->state = simpleButton_State_Wait_For_Interrupt;
-    self_private->timeStamp_interrupt = 0;
+    simpleButton_Private_StampPush(self_private, 0);
     self_private->timeStamp_loop = 0;
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+    self_private->debounce = SIMPLEBTN_DEBOUNCE_MAX; /* start safe, tune down */
+    self_private->bounce = 0;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+    self_private->integrator = 0; /* released */
+    self_private->timeStamp_sample = 0;
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
 }
 
 SIMPLEBTN_C_API void simpleButton_Private_InitStructMethods(
@@ -103,24 +171,433 @@ SIMPLEBTN_C_API void simpleButton_Private_InitStruct(
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END();
 }
 
+#if SIMPLEBTN_MODE_ENABLE_PROFILING != 0
+
+/* The cycle statistics of each profiled site */
+static SimpleButton_Type_ProfStat_t simpleButton_ProfSite[SIMPLEBTN__PROF_SITE_NUM];
+
+/* Cycles spent in the callbacks of the running state handler (not counted for it) */
+static uint32_t simpleButton_ProfCallbackCycles = 0;
+
+/* Add one sample to the statistics */
+static void simpleButton_Private_ProfAdd(SimpleButton_Type_ProfStat_t* const stat, const uint32_t cycles)
+{
+    uint8_t bin;
+
+#if defined(__GNUC__) || defined(__clang__)
+    bin = (cycles > 1) ? (uint8_t)(31 - __builtin_clz(cycles)) : 0;
+#else
+    uint32_t rest = cycles;
+    for (bin = 0; rest > 1; bin++) {
+        rest >>= 1;
+    }
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+    if (bin >= SIMPLEBTN_PROFILE_HIST_BINS) {
+        bin = SIMPLEBTN_PROFILE_HIST_BINS - 1; /* the last bin is open */
+    }
+
+    if (stat->count == 0 || cycles < stat->min) {
+        stat->min = cycles;
+    }
+    if (cycles > stat->max) {
+        stat->max = cycles;
+    }
+    stat->sum += cycles;
+    stat->count ++;
+    if (stat->hist[bin] != 0xFFFF) {
+        stat->hist[bin] ++;
+    }
+}
+
+/* Call a user callback and profile it, its cycles are not counted for the state handler */
+ #define SIMPLEBTN_PROFILE_CALL(Site, Call)                                     \
+    do {                                                                        \
+        const uint32_t prof_call_start = SIMPLEBTN_FUNC_GET_CYCLE();            \
+        uint32_t prof_call_cycles;                                              \
+        Call;                                                                   \
+        prof_call_cycles = SIMPLEBTN_FUNC_GET_CYCLE() - prof_call_start;        \
+        simpleButton_Private_ProfAdd(&(simpleButton_ProfSite[Site]), prof_call_cycles); \
+        simpleButton_ProfCallbackCycles += prof_call_cycles;                    \
+    } while (0)
+
+/**
+ * @brief           Read the cycle statistics of a profiled site.
+ * 
+ * @param[in]       site - `SimpleButton_Prof_Interrupt`, `SimpleButton_Prof_xxxCallBack`,
+ *                  or `SimpleButton_Prof_State + simpleButton_State_xxx`.
+ * @param[out]      stat - The copy of the statistics (all 0 if the site is invalid).
+ * 
+ * @note            The cycles of the state handlers do not include the callbacks.
+ *                  The statistics of a button are kept in `Public.profile` of it.
+ * 
+ * @return          None
+ */
+SIMPLEBTN_C_API void SimpleButton_Profile_Read(const uint8_t site, SimpleButton_Type_ProfStat_t* const stat)
+{
+    if (site >= SIMPLEBTN__PROF_SITE_NUM) {
+        SimpleButton_Profile_Clear(stat);
+        return;
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* the interrupt site is written in the ISR */
+
+    *stat = simpleButton_ProfSite[site];
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END();
+}
+
+/**
+ * @brief           Clear the statistics, e.g. `&(SimpleButton_xxx.Public.profile)`.
+ * @param[out]      stat - The statistics to clear.
+ * @return          None
+ */
+SIMPLEBTN_C_API void SimpleButton_Profile_Clear(SimpleButton_Type_ProfStat_t* const stat)
+{
+    uint8_t bin;
+
+    stat->count = 0;
+    stat->min = 0;
+    stat->max = 0;
+    stat->sum = 0;
+    for (bin = 0; bin < SIMPLEBTN_PROFILE_HIST_BINS; bin++) {
+        stat->hist[bin] = 0;
+    }
+}
+
+/**
+ * @brief           Clear the statistics of all the profiled sites.
+ * @return          None
+ */
+SIMPLEBTN_C_API void SimpleButton_Profile_Reset(void)
+{
+    uint8_t site;
+
+    for (site = 0; site < SIMPLEBTN__PROF_SITE_NUM; site++) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN();
+        SimpleButton_Profile_Clear(&(simpleButton_ProfSite[site]));
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END();
+    }
+}
+
+#else
+
+ #define SIMPLEBTN_PROFILE_CALL(Site, Call)     Call
+
+#endif /* SIMPLEBTN_MODE_ENABLE_PROFILING != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_TRACE != 0
+
+/* The trace ring buffer */
+static SimpleButton_Type_Trace_t simpleButton_Trace = {
+    SIMPLEBTN__TRACE_MAGIC,
+    (uint8_t)sizeof(SimpleButton_Type_TraceRecord_t),
+    (uint8_t)(((SIMPLEBTN_MODE_ENABLE_COMBINATION != 0) ? 1U : 0U) | ((SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0) ? 2U : 0U)),
+    SIMPLEBTN_TRACE_SIZE,
+    0,
+    0,
+    {{0, 0, 0, 0}}
+};
+
+/* Append one trace record. Call it in the ISR or with the interrupts disabled. */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_TraceWrite(
+    const volatile void* const button,
+    const uint8_t kind,
+    const uint8_t arg,
+    const uint32_t now
+) {
+    uint32_t delta = now - simpleButton_Trace.lastTime;
+    SimpleButton_Type_TraceRecord_t* record;
+
+    if ((int32_t)delta < 0) {
+        delta = 0; /* `now` was taken before the last record of the ISR */
+    } else {
+        simpleButton_Trace.lastTime = now;
+    }
+
+    if (delta > 0xFFFFUL) {
+        record = &(simpleButton_Trace.record[simpleButton_Trace.head & (SIMPLEBTN_TRACE_SIZE - 1)]);
+        record->delta = (uint16_t)(delta >> 16);
+        record->button = 0;
+        record->kind = (uint8_t)SimpleButton_Trace_TimeHigh;
+        record->arg = 0;
+        simpleButton_Trace.head ++;
+    }
+
+    record = &(simpleButton_Trace.record[simpleButton_Trace.head & (SIMPLEBTN_TRACE_SIZE - 1)]);
+    record->delta = (uint16_t)delta;
+    record->button = (uint16_t)(uintptr_t)button;
+    record->kind = kind;
+    record->arg = arg;
+    simpleButton_Trace.head ++;
+}
+
+/* Record in the ISR, or with the interrupts disabled */
+ #define SIMPLEBTN_TRACE_ISR(Button, Kind, Arg, Now) \
+    simpleButton_Private_TraceWrite((Button), (uint8_t)(Kind), (uint8_t)(Arg), (Now))
+
+/* Record in the thread */
+ #define SIMPLEBTN_TRACE(Button, Kind, Arg, Now)                                \
+    do {                                                                        \
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN();                                \
+        SIMPLEBTN_TRACE_ISR(Button, Kind, Arg, Now);                            \
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END();                                  \
+    } while (0)
+
+/* Record in the multi-thread critical section (the interrupts are already disabled) */
+ #if SIMPLEBTN_MODE_ENABLE_MULTI_THREADS != 0
+  #define SIMPLEBTN_TRACE_M(Button, Kind, Arg, Now)     SIMPLEBTN_TRACE_ISR(Button, Kind, Arg, Now)
+ #else
+  #define SIMPLEBTN_TRACE_M(Button, Kind, Arg, Now)     SIMPLEBTN_TRACE(Button, Kind, Arg, Now)
+ #endif /* SIMPLEBTN_MODE_ENABLE_MULTI_THREADS != 0 */
+
+/**
+ * @brief           Get the trace ring buffer, e.g. to dump it for tools/sBtn_trace_decode.c.
+ * 
+ * @note            The buttons keep recording, copy it in a critical section
+ *                  for a consistent dump.
+ * 
+ * @return          The pointer of the trace ring buffer.
+ */
+SIMPLEBTN_C_API const SimpleButton_Type_Trace_t* SimpleButton_Trace_Get(void)
+{
+    return &simpleButton_Trace;
+}
+
+/**
+ * @brief           Drop all the records of the trace ring buffer.
+ * @return          None
+ */
+SIMPLEBTN_C_API void SimpleButton_Trace_Clear(void)
+{
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    simpleButton_Trace.head = 0;
+    simpleButton_Trace.lastTime = 0;
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+#else
+
+ #define SIMPLEBTN_TRACE_ISR(Button, Kind, Arg, Now)    do {} while (0)
+ #define SIMPLEBTN_TRACE(Button, Kind, Arg, Now)        do {} while (0)
+ #define SIMPLEBTN_TRACE_M(Button, Kind, Arg, Now)      do {} while (0)
+
+#endif /* SIMPLEBTN_MODE_ENABLE_TRACE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0
+
+/* Registry buttons woken by their EXTI since the last pass (bit = registry id) */
+static volatile uint32_t simpleButton_HeapWoken[(SIMPLEBTN_REGISTRY_CAPACITY + 31) / 32];
+
+#endif /* SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0 */
+
 /**
  * @brief           Change the status of each button when during the EXTI interrupt
  *                  service routine.
  * 
+ * @param[inout]    self_private - pointer to self.Private struct.
+ * @param[in]       gpio_pin_x - GPIO pin (mask) of the button, which is also its EXTI line.
+ *                  In EXTI-masking mode the line is masked on the accepted edge.
+ * 
  * @return          None
  */
 SIMPLEBTN_C_API void simpleButton_Private_InterruptHandler(
-    simpleButton_Type_PrivateBtnStatus_t* self_private
+    simpleButton_Type_PrivateBtnStatus_t* self_private,
+    simpleButton_Type_GPIOPin_t gpio_pin_x
 ) {
+#if SIMPLEBTN_MODE_ENABLE_PROFILING != 0
+    const uint32_t prof_start = SIMPLEBTN_FUNC_GET_CYCLE();
+#endif /* SIMPLEBTN_MODE_ENABLE_PROFILING != 0 */
+
+    (void)gpio_pin_x;
+
     if (
         (simpleButton_Type_ButtonState_t)(self_private->state) == simpleButton_State_Wait_For_Interrupt
         || (simpleButton_Type_ButtonState_t)(self_private->state) == simpleButton_State_Wait_For_Repeat
     ) {
-        self_private->timeStamp_interrupt = SIMPLEBTN_FUNC_GET_TICK_FromISR();
+        const uint32_t now = SIMPLEBTN_FUNC_GET_TICK_FromISR();
+
+        simpleButton_Private_StampPush(self_private, now);
         self_private->state = simpleButton_State_Push_Delay;
+        SIMPLEBTN_TRACE_ISR(self_private, SimpleButton_Trace_Exti, 1, now);
+
+#if SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0
+        /* the bounce of this press raises no more interrupt */
+        SIMPLEBTN_FUNC_EXTI_MASK(gpio_pin_x);
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0
+        if (self_private->heap_slot != 0) {
+            const uint8_t id = (uint8_t)(self_private->heap_slot - 1);
+            simpleButton_HeapWoken[id >> 5] |= (uint32_t)1 << (id & 31U);
+        }
+#endif /* SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0 */
+    }
+#if SIMPLEBTN_MODE_ENABLE_TRACE != 0
+    else {
+        SIMPLEBTN_TRACE_ISR(self_private, SimpleButton_Trace_Exti, 0, SIMPLEBTN_FUNC_GET_TICK_FromISR());
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_TRACE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_PROFILING != 0
+    simpleButton_Private_ProfAdd(
+        &(simpleButton_ProfSite[SimpleButton_Prof_Interrupt]),
+        SIMPLEBTN_FUNC_GET_CYCLE() - prof_start
+    );
+#endif /* SIMPLEBTN_MODE_ENABLE_PROFILING != 0 */
+}
+
+#if SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0 || SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0
+
+/* Count trailing zeros of a non-zero value */
+#if defined(__GNUC__) || defined(__clang__)
+ #define SIMPLEBTN_CTZ(x)               ((uint8_t)__builtin_ctz(x))
+#else
+SIMPLEBTN_FORCE_INLINE uint8_t simpleButton_Private_Ctz(uint32_t x) {
+    uint8_t n = 0;
+    while ((x & 1U) == 0) {
+        x >>= 1;
+        n ++;
+    }
+    return n;
+}
+ #define SIMPLEBTN_CTZ(x)               simpleButton_Private_Ctz(x)
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0 || SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0
+
+/* The number of EXTI lines that GPIO pins can use */
+#define SIMPLEBTN_EXTI_LINE_NUM         16
+
+/* The button bound to each EXTI line, and the mask of bound lines */
+static simpleButton_Type_PrivateBtnStatus_t* simpleButton_ExtiButton[SIMPLEBTN_EXTI_LINE_NUM];
+
+static uint32_t simpleButton_ExtiLines = 0;
+
+/**
+ * @brief           Bind the EXTI line of a pin to a button (called at init).
+ *                  One EXTI line serves only one pin, the last bound button wins.
+ * 
+ * @param[inout]    self_private - pointer to self.Private struct.
+ * @param[in]       gpio_pin_x - GPIO pin (mask) of the button.
+ * 
+ * @return          None
+ */
+SIMPLEBTN_C_API void simpleButton_Private_ExtiAttach(
+    simpleButton_Type_PrivateBtnStatus_t* self_private,
+    simpleButton_Type_GPIOPin_t gpio_pin_x
+) {
+    const uint32_t line = (uint32_t)gpio_pin_x;
+
+    if (line == 0 || (line & (line - 1)) != 0 || line >= (1UL << SIMPLEBTN_EXTI_LINE_NUM)) {
+        return; /* not a single pin */
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    simpleButton_ExtiButton[SIMPLEBTN_CTZ(line)] = self_private;
+    simpleButton_ExtiLines |= line;
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/**
+ * @brief           The EXTI interrupt service routine of buttons, shared by all
+ *                  the interrupt vectors. The pending flags are read once, every
+ *                  pending button line is handled and cleared in one write.
+ * 
+ * @param[in]       EXTI_Lines - The lines served by the calling vector,
+ *                  e.g. `EXTI_Line0` or `SIMPLEBTN__EXTI_LINES_15_10`.
+ *                  Lines without a button are never touched.
+ * 
+ * @return          None
+ */
+SIMPLEBTN_C_API HOT_ void SimpleButton_EXTI_Dispatch(const uint32_t EXTI_Lines)
+{
+    const uint32_t handled = (uint32_t)SIMPLEBTN_FUNC_EXTI_GET_PENDING()
+        & EXTI_Lines & simpleButton_ExtiLines;
+    uint32_t pending = handled;
+
+    while (pending != 0) {
+        simpleButton_Private_InterruptHandler(
+            simpleButton_ExtiButton[SIMPLEBTN_CTZ(pending)],
+            (simpleButton_Type_GPIOPin_t)(pending & (0U - pending)) /* the lowest set bit */
+        );
+        pending &= pending - 1; /* clear the lowest set bit */
+    }
+
+    if (handled != 0) {
+        SIMPLEBTN_FUNC_EXTI_CLEAR_PENDING(handled);
+    }
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0 */
+
+/* Id of a button that is not handled through the registry (uses callbacks) */
+#define SIMPLEBTN_BUTTON_ID_NONE        0xFF
+
+#if SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0
+
+/* Single-producer (State-Machine) / single-consumer (application) ring buffer */
+static struct {
+
+    SimpleButton_Type_Event_t           buffer[SIMPLEBTN_EVENT_QUEUE_SIZE];
+
+    volatile uint8_t                    head; /* written by producer only */
+
+    volatile uint8_t                    tail; /* written by consumer only */
+
+    volatile uint32_t                   dropped; /* events lost because queue was full */
+
+} simpleButton_EventQueue;
+
+/* Push one event record, drop it if the queue is full */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_EventPost(
+    const simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint8_t id,
+    const SimpleButton_Type_EventType_t type,
+    const uint32_t now
+) {
+    const uint8_t head = simpleButton_EventQueue.head;
+    const uint8_t next = (uint8_t)((head + 1) & (SIMPLEBTN_EVENT_QUEUE_SIZE - 1));
+    SimpleButton_Type_Event_t* const event = &(simpleButton_EventQueue.buffer[head]);
+    uint32_t duration;
+
+    if (next == simpleButton_EventQueue.tail) {
+        simpleButton_EventQueue.dropped = simpleButton_EventQueue.dropped + 1;
+        return; /* queue is full */
     }
+
+    event->timeStamp = now;
+    duration = simpleButton_Private_PushedFor(self_private, now);
+    event->duration = (uint16_t)((duration > 0xFFFFUL) ? 0xFFFFUL : duration);
+    event->id = id;
+    event->type = (uint8_t)type;
+    event->repeatCount = self_private->push_time;
+
+    SIMPLEBTN_MEMORY_BARRIER(); /* record must be complete before it is published */
+    simpleButton_EventQueue.head = next;
+
+    SIMPLEBTN_TRACE_M(self_private, SimpleButton_Trace_CallBack, (uint8_t)type | 0x80U, now);
 }
 
+#endif /* SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0 */
+
+/* The push / release delay of a button */
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+ #define SIMPLEBTN_PUSH_DELAY(self_private)     ((uint32_t)((self_private)->debounce))
+ #define SIMPLEBTN_RELEASE_DELAY(self_private)  ((uint32_t)((self_private)->debounce))
+#else
+ #define SIMPLEBTN_PUSH_DELAY(self_private)     SIMPLEBTN_TIME_PUSH_DELAY
+ #define SIMPLEBTN_RELEASE_DELAY(self_private)  SIMPLEBTN_TIME_RELEASE_DELAY
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateWaitForInterrupt_Handler(void) {
     /* Do nothing */
@@ -129,15 +606,21 @@ simpleButton_Private_StateWaitForInterrupt_Handler(void) {
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StatePushDelay_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val
+    const uint8_t is_pushed,
+    const uint8_t is_debounced,
+    const uint32_t now
 ) {
-    if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt <= SIMPLEBTN_TIME_PUSH_DELAY) {
+    if (is_debounced && is_pushed) {
+        self_private->state = simpleButton_State_Wait_For_End;
+        return; /* the level is already debounced, no need to wait */
+    }
+
+    /* signed: the EXTI may stamp a tick newer than the snapshot `now` */
+    if (simpleButton_Private_SignedSince(now, self_private->timeStamp_interrupt) <= (int32_t)SIMPLEBTN_PUSH_DELAY(self_private)) {
         return; /* still need wait */
     }
 
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) != normal_pin_val) {
+    if (is_pushed) {
         self_private->state = simpleButton_State_Wait_For_End;
     } else {
         if (self_private->push_time == 0) {
@@ -152,26 +635,25 @@ SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateWaitForEnd_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
     simpleButton_Type_PublicBtnStatus_t* const self_public,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val
+    const uint8_t is_pushed,
+    const uint32_t now
 ) {
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) == normal_pin_val) {
-        self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
+    if (!is_pushed) {
+        self_private->timeStamp_loop = SIMPLEBTN_STAMP(now);
         self_private->state = simpleButton_State_Release_Delay;
     } 
 #if SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
  #if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
-    else if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt > self_public->holdPushMinTime)
+    else if (simpleButton_Private_PushedFor(self_private, now) > self_public->holdPushMinTime)
  #else
-    else if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt > SIMPLEBTN_TIME_HOLD_PUSH_MIN)
+    else if (simpleButton_Private_PushedFor(self_private, now) > SIMPLEBTN_TIME_HOLD_PUSH_MIN)
  #endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
     {
-        self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
+        self_private->timeStamp_loop = SIMPLEBTN_STAMP(now);
         self_private->state = simpleButton_State_Hold_Push;
     }
 #endif /* SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0 */
-    else if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt > SIMPLEBTN_TIME__TIMEOUT_NORMAL) {
+    else if (simpleButton_Private_PushedFor(self_private, now) > SIMPLEBTN_TIME__TIMEOUT_NORMAL) {
 
 #if defined(SIMPLEBTN_DEBUG)
         SIMPLEBTN_FUNC_PANIC("normal long push time out", , );
@@ -186,15 +668,16 @@ simpleButton_Private_StateWaitForEnd_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateWaitForRepeat_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    simpleButton_Type_PublicBtnStatus_t* const self_public
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint32_t now
 ) {
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* begin always critical section */
 
 #if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
-    if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop > (uint32_t)self_public->repeatWindowTime)
+    if (simpleButton_Private_Since(now, self_private->timeStamp_loop) > (uint32_t)self_public->repeatWindowTime)
 #else
-    if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop > SIMPLEBTN_TIME_REPEAT_WINDOW)
+    if (simpleButton_Private_Since(now, self_private->timeStamp_loop) > SIMPLEBTN_TIME_REPEAT_WINDOW)
 #endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
     {
 
@@ -218,21 +701,35 @@ simpleButton_Private_StateWaitForRepeat_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_Do_LongPush(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    simpleButton_Type_LongPushCallBack_t longPushCallBack
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    const uint8_t id,
+    const uint32_t now
 ) {
 
+#if SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0
+    if (id != SIMPLEBTN_BUTTON_ID_NONE) {
+        simpleButton_Private_EventPost(self_private, id, SimpleButton_Event_Long_Push, now);
+        return;
+    }
+#else
+    (void)id;
+#endif /* SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0 */
+
 #if SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH == 0
     (void)self_private;
+    (void)now;
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
     if (longPushCallBack != 0) {
-        longPushCallBack();
+        SIMPLEBTN_TRACE(self_private, SimpleButton_Trace_CallBack, SimpleButton_Trace_LongPushCallBack, now);
+        SIMPLEBTN_PROFILE_CALL(SimpleButton_Prof_LongPushCallBack, longPushCallBack());
     }
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
 #else
-    uint32_t longPushTime = SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt;
+    uint32_t longPushTime = simpleButton_Private_PushedFor(self_private, now);
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
     if (longPushCallBack != 0) {
-        longPushCallBack(longPushTime);
+        SIMPLEBTN_TRACE(self_private, SimpleButton_Trace_CallBack, SimpleButton_Trace_LongPushCallBack, now);
+        SIMPLEBTN_PROFILE_CALL(SimpleButton_Prof_LongPushCallBack, longPushCallBack(longPushTime));
     }
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
 #endif /* SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH == 0 */
@@ -241,11 +738,26 @@ simpleButton_Private_Do_LongPush(
 
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_Do_ShortPush(
-    simpleButton_Type_ShortPushCallBack_t shortPushCallBack
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    const uint8_t id,
+    const uint32_t now
 ) {
+
+#if SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0
+    if (id != SIMPLEBTN_BUTTON_ID_NONE) {
+        simpleButton_Private_EventPost(self_private, id, SimpleButton_Event_Short_Push, now);
+        return;
+    }
+#else
+    (void)self_private;
+    (void)id;
+    (void)now;
+#endif /* SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0 */
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
     if (shortPushCallBack != 0) {
-        shortPushCallBack();
+        SIMPLEBTN_TRACE(self_private, SimpleButton_Trace_CallBack, SimpleButton_Trace_ShortPushCallBack, now);
+        SIMPLEBTN_PROFILE_CALL(SimpleButton_Prof_ShortPushCallBack, shortPushCallBack());
     }
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
 }
@@ -255,45 +767,63 @@ simpleButton_Private_StateSinglePush_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
     simpleButton_Type_PublicBtnStatus_t* const self_public,
     simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
-    simpleButton_Type_LongPushCallBack_t longPushCallBack
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    const uint8_t id,
+    const uint32_t now
 ) {
     
 #if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
-    if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt > (uint32_t)self_public->longPushMinTime)
+    if (simpleButton_Private_PushedFor(self_private, now) > (uint32_t)self_public->longPushMinTime)
 #else
-    if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt > SIMPLEBTN_TIME_LONG_PUSH_MIN)
+    if (simpleButton_Private_PushedFor(self_private, now) > SIMPLEBTN_TIME_LONG_PUSH_MIN)
 #endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
     {
-        simpleButton_Private_Do_LongPush(self_private, longPushCallBack);
+        simpleButton_Private_Do_LongPush(self_private, longPushCallBack, id, now);
     } else {
-        simpleButton_Private_Do_ShortPush(shortPushCallBack);
+        simpleButton_Private_Do_ShortPush(self_private, shortPushCallBack, id, now);
     }
 
     self_private->push_time = 0;
-    self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
+    self_private->timeStamp_loop = SIMPLEBTN_STAMP(now);
     self_private->state = simpleButton_State_Cool_Down;
 }
 
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateRepeatPush_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack,
+    const uint8_t id,
+    const uint32_t now
 ) {
+
+#if SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0
+    if (id != SIMPLEBTN_BUTTON_ID_NONE) {
+        simpleButton_Private_EventPost(self_private, id, SimpleButton_Event_Repeat_Push, now);
+        self_private->push_time = 0;
+        self_private->timeStamp_loop = SIMPLEBTN_STAMP(now);
+        self_private->state = simpleButton_State_Cool_Down;
+        return;
+    }
+#else
+    (void)id;
+#endif /* SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0 */
+
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
 
     if (repeatPushCallBack != 0) {
+        SIMPLEBTN_TRACE(self_private, SimpleButton_Trace_CallBack, SimpleButton_Trace_RepeatPushCallBack, now);
 
 #if SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0
-        repeatPushCallBack();
+        SIMPLEBTN_PROFILE_CALL(SimpleButton_Prof_RepeatPushCallBack, repeatPushCallBack());
 #else
-        repeatPushCallBack(self_private->push_time);
+        SIMPLEBTN_PROFILE_CALL(SimpleButton_Prof_RepeatPushCallBack, repeatPushCallBack(self_private->push_time));
 #endif /* SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0 */
 
     } /* end if */
 
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
     self_private->push_time = 0;
-    self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
+    self_private->timeStamp_loop = SIMPLEBTN_STAMP(now);
     self_private->state = simpleButton_State_Cool_Down;
 }
 
@@ -301,7 +831,8 @@ simpleButton_Private_StateRepeatPush_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_CmbBtnAfterReleaseOK(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    simpleButton_Type_PublicBtnStatus_t* const self_public
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint32_t now
 ) {
 #if SIMPLEBTN_MODE_ENABLE_COMBINATION != 0
 
@@ -315,6 +846,8 @@ simpleButton_Private_CmbBtnAfterReleaseOK(
             return; /* prev-button isn't [Combination]_WaitForEnd. */
         } else {
             self_public->combinationConfig.previousButton->state = simpleButton_State_Combination_WaitForEnd;
+            SIMPLEBTN_TRACE_M(self_public->combinationConfig.previousButton,
+                SimpleButton_Trace_Transition, simpleButton_State_Combination_WaitForEnd, now);
         }
     }
 
@@ -323,14 +856,35 @@ simpleButton_Private_CmbBtnAfterReleaseOK(
 #endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
 }
 
+/* a helper function: the button doesn't need the repeat window, when nothing
+   consumes a repeat push (no callback and no event queue), or the window is 0 */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_NoRepeatWindow(
+    const simpleButton_Type_PublicBtnStatus_t* const self_public,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCB,
+    const uint8_t id
+) {
+#if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
+    if (self_public->repeatWindowTime == 0) {
+        return 1;
+    }
+#else
+    (void)self_public;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
+
+    return (uint8_t)(repeatPushCB == 0 && id == SIMPLEBTN_BUTTON_ID_NONE);
+}
+
 /* a helper function */
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_ReleaseOK(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    simpleButton_Type_PublicBtnStatus_t* const self_public
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint8_t no_repeat,
+    const uint32_t now
 ) {
     self_private->push_time ++;
-    self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
+    self_private->timeStamp_loop = SIMPLEBTN_STAMP(now);
 
     /* enable counter-repeat-push or not */
 #if SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0
@@ -341,7 +895,12 @@ simpleButton_Private_ReleaseOK(
         ? simpleButton_State_Wait_For_Repeat : simpleButton_State_Repeat_Push;
 #endif /* SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0 */
 
-    simpleButton_Private_CmbBtnAfterReleaseOK(self_private, self_public);
+    /* no repeat push to wait for, report the single push at once */
+    if (no_repeat && self_private->push_time == 1) {
+        self_private->state = simpleButton_State_Single_Push;
+    }
+
+    simpleButton_Private_CmbBtnAfterReleaseOK(self_private, self_public, now);
 }
 
 
@@ -349,16 +908,22 @@ SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateReleaseDelay_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
     simpleButton_Type_PublicBtnStatus_t* const self_public,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val
+    const uint8_t is_pushed,
+    const uint8_t is_debounced,
+    const uint8_t no_repeat,
+    const uint32_t now
 ) {
-    if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop <= SIMPLEBTN_TIME_RELEASE_DELAY) {
+    if (is_debounced && !is_pushed) {
+        simpleButton_Private_ReleaseOK(self_private, self_public, no_repeat, now);
+        return; /* the level is already debounced, no need to wait */
+    }
+
+    if (simpleButton_Private_Since(now, self_private->timeStamp_loop) <= SIMPLEBTN_RELEASE_DELAY(self_private)) {
         return; /* still need wait */
     }
 
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) == normal_pin_val) {
-        simpleButton_Private_ReleaseOK(self_private, self_public);
+    if (!is_pushed) {
+        simpleButton_Private_ReleaseOK(self_private, self_public, no_repeat, now);
     } else {
         self_private->state = simpleButton_State_Wait_For_End;
     }
@@ -367,12 +932,13 @@ simpleButton_Private_StateReleaseDelay_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateCoolDown_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    simpleButton_Type_PublicBtnStatus_t* const self_public
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint32_t now
 ) {
 #if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
-    if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop > self_public->coolDownTime)
+    if (simpleButton_Private_Since(now, self_private->timeStamp_loop) > self_public->coolDownTime)
 #else
-    if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop > SIMPLEBTN_TIME_COOL_DOWN)
+    if (simpleButton_Private_Since(now, self_private->timeStamp_loop) > SIMPLEBTN_TIME_COOL_DOWN)
 #endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
     {
         self_private->state = simpleButton_State_Wait_For_Interrupt;
@@ -384,33 +950,47 @@ simpleButton_Private_StateCoolDown_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateCombinationPush_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    simpleButton_Type_PublicBtnStatus_t* const self_public
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint8_t id,
+    const uint32_t now
 ) {
     simpleButton_Type_CombinationPushCallBack_t cmbCallBack;
     cmbCallBack = self_public->combinationConfig.callBack;
 
+ #if SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0
+    if (id != SIMPLEBTN_BUTTON_ID_NONE) {
+        simpleButton_Private_EventPost(self_private, id, SimpleButton_Event_Combination_Push, now);
+        self_private->push_time = 0;
+        self_private->timeStamp_loop = SIMPLEBTN_STAMP(now);
+        self_private->state = simpleButton_State_Cool_Down;
+        return;
+    }
+ #else
+    (void)id;
+ #endif /* SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0 */
+
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
 
     if (cmbCallBack != 0) {
-        cmbCallBack();
+        SIMPLEBTN_TRACE(self_private, SimpleButton_Trace_CallBack, SimpleButton_Trace_CombinationCallBack, now);
+        SIMPLEBTN_PROFILE_CALL(SimpleButton_Prof_CombinationCallBack, cmbCallBack());
     }
 
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
     self_private->push_time = 0;
-    self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
+    self_private->timeStamp_loop = SIMPLEBTN_STAMP(now);
     self_private->state = simpleButton_State_Cool_Down;
 }
 
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateCombinationWaitForEnd_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val
+    const uint8_t is_pushed,
+    const uint32_t now
 ) {
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) == normal_pin_val) {
+    if (!is_pushed) {
         self_private->state = simpleButton_State_Combination_Release;
-    } else if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt > SIMPLEBTN_TIME__TIMEOUT_COMBINATION) {
+    } else if (simpleButton_Private_PushedFor(self_private, now) > SIMPLEBTN_TIME__TIMEOUT_COMBINATION) {
 
 #if defined(SIMPLEBTN_DEBUG)
         SIMPLEBTN_FUNC_PANIC("combination long push time out", , );
@@ -425,17 +1005,16 @@ simpleButton_Private_StateCombinationWaitForEnd_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateCombinationRelease_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val
+    const uint8_t is_pushed,
+    const uint32_t now
 ) {
-    if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop <= SIMPLEBTN_TIME_RELEASE_DELAY) {
+    if (simpleButton_Private_Since(now, self_private->timeStamp_loop) <= SIMPLEBTN_RELEASE_DELAY(self_private)) {
         return; /* still need wait */
     }
 
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) == normal_pin_val) {
+    if (!is_pushed) {
         self_private->push_time = 0;
-        self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
+        self_private->timeStamp_loop = SIMPLEBTN_STAMP(now);
         self_private->state = simpleButton_State_Cool_Down;
     } else {
         self_private->state = simpleButton_State_Combination_WaitForEnd;
@@ -450,36 +1029,35 @@ simpleButton_Private_StateCombinationRelease_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateHoldPush_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val,
-    const simpleButton_Type_LongPushCallBack_t longPushCallBack
+    const uint8_t is_pushed,
+    const simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    const uint8_t id,
+    const uint32_t now
 ) {
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) == normal_pin_val) {
-        self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
+    if (!is_pushed) {
+        self_private->timeStamp_loop = SIMPLEBTN_STAMP(now);
         self_private->state = simpleButton_State_Hold_Release;
     }
 
-    if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop > SIMPLEBTN_TIME_HOLD_INTERVAL) {
-        simpleButton_Private_Do_LongPush(self_private, longPushCallBack);
-        self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
+    if (simpleButton_Private_Since(now, self_private->timeStamp_loop) > SIMPLEBTN_TIME_HOLD_INTERVAL) {
+        simpleButton_Private_Do_LongPush(self_private, longPushCallBack, id, now);
+        self_private->timeStamp_loop = SIMPLEBTN_STAMP(now);
     }
 }
 
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateHoldRelease_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val
+    const uint8_t is_pushed,
+    const uint32_t now
 ) {
-    if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop <= SIMPLEBTN_TIME_RELEASE_DELAY) {
+    if (simpleButton_Private_Since(now, self_private->timeStamp_loop) <= SIMPLEBTN_RELEASE_DELAY(self_private)) {
         return; /* still need wait */
     }
 
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) == normal_pin_val) {
+    if (!is_pushed) {
         self_private->push_time = 0;
-        self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
+        self_private->timeStamp_loop = SIMPLEBTN_STAMP(now);
         self_private->state = simpleButton_State_Cool_Down;
     } else {
         self_private->state = simpleButton_State_Hold_Push;
@@ -504,31 +1082,446 @@ simpleButton_Private_StateDefault_Handler(
 
 }
 
-/**
- * @brief           Asynchronously call the callback function in while loop.
- * @param[inout]    self_private - pointer to self.Private struct.
- * @param[inout]    self_public - pointer to self.Public struct.
- * @param[in]       gpiox_base - Address of GPIO port connected to the button.
- * @param[in]       gpio_pin_x - GPIO pin number connected to the button.
- * @param[in]       normal_pin_val - Normal(didn't push) pin value of button pin. (can be 1 or 0)
- * @param[in]       shortPushCB - callback function for short push.
- * @param[in]       longPushCB - callback function for long push.
- * @param[in]       repeatPushCB - callback function for repeat push.
- * @return          None
- */
-SIMPLEBTN_C_API HOT_ void
-simpleButton_Private_AsynchronousHandler(
-    simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    simpleButton_Type_PublicBtnStatus_t* const self_public,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val,
-    simpleButton_Type_ShortPushCallBack_t shortPushCB,
-    simpleButton_Type_LongPushCallBack_t longPushCB,
-    simpleButton_Type_RepeatPushCallBack_t repeatPushCB
-) {
+/* Mask of the states that look at the pin level */
+#define SIMPLEBTN_STATE_MASK(state)     (1UL << (uint32_t)(state))
+
+#if SIMPLEBTN_MODE_ENABLE_COMBINATION != 0
+ #define SIMPLEBTN_STATE_MASK_READ_PIN_CMB                      \
+    ( SIMPLEBTN_STATE_MASK(simpleButton_State_Combination_WaitForEnd)   \
+    | SIMPLEBTN_STATE_MASK(simpleButton_State_Combination_Release) )
+#else
+ #define SIMPLEBTN_STATE_MASK_READ_PIN_CMB      0UL
+#endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
+ #define SIMPLEBTN_STATE_MASK_READ_PIN_HOLD                     \
+    ( SIMPLEBTN_STATE_MASK(simpleButton_State_Hold_Push)        \
+    | SIMPLEBTN_STATE_MASK(simpleButton_State_Hold_Release) )
+#else
+ #define SIMPLEBTN_STATE_MASK_READ_PIN_HOLD     0UL
+#endif /* SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0 */
+
+/* States in which the State-Machine reads the pin */
+#define SIMPLEBTN_STATE_MASK_READ_PIN                           \
+    ( SIMPLEBTN_STATE_MASK(simpleButton_State_Push_Delay)       \
+    | SIMPLEBTN_STATE_MASK(simpleButton_State_Wait_For_End)     \
+    | SIMPLEBTN_STATE_MASK(simpleButton_State_Release_Delay)    \
+    | SIMPLEBTN_STATE_MASK_READ_PIN_CMB                         \
+    | SIMPLEBTN_STATE_MASK_READ_PIN_HOLD )
+
+/* States in which a dynamic-button (polling) reads the pin */
+#define SIMPLEBTN_STATE_MASK_POLL_PIN                           \
+    ( SIMPLEBTN_STATE_MASK_READ_PIN                             \
+    | SIMPLEBTN_STATE_MASK(simpleButton_State_Wait_For_Interrupt)   \
+    | SIMPLEBTN_STATE_MASK(simpleButton_State_Wait_For_Repeat) )
+
+#if SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0
+
+/* States between the debounced push and the debounced release */
+#define SIMPLEBTN_STATE_MASK_HELD                               \
+    ( SIMPLEBTN_STATE_MASK(simpleButton_State_Wait_For_End)     \
+    | SIMPLEBTN_STATE_MASK(simpleButton_State_Release_Delay)    \
+    | SIMPLEBTN_STATE_MASK_READ_PIN_CMB                         \
+    | SIMPLEBTN_STATE_MASK_READ_PIN_HOLD )
+
+/* Report the press (or the release) when a pass enters (or leaves) the held
+   states. A bounce in Release_Delay stays held, so no event is reported.
+   `state_before` is the state before this pass. */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_PressEvent(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint8_t state_before,
+    const uint8_t id,
+    const uint32_t now
+) {
+    const uint8_t is_held = (uint8_t)((SIMPLEBTN_STATE_MASK(self_private->state) & SIMPLEBTN_STATE_MASK_HELD) != 0);
+    simpleButton_Type_PressCallBack_t callBack;
+
+    if (is_held == (uint8_t)((SIMPLEBTN_STATE_MASK(state_before) & SIMPLEBTN_STATE_MASK_HELD) != 0)) {
+        return;
+    }
+
+ #if SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0
+    if (id != SIMPLEBTN_BUTTON_ID_NONE) {
+        simpleButton_Private_EventPost(self_private, id,
+            is_held ? SimpleButton_Event_Press : SimpleButton_Event_Release, now);
+        return;
+    }
+ #else
+    (void)id;
+ #endif /* SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0 */
+
+    callBack = is_held ? self_public->pressCallBack : self_public->releaseCallBack;
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
+    if (callBack != 0) {
+        SIMPLEBTN_TRACE(self_private, SimpleButton_Trace_CallBack,
+            is_held ? SimpleButton_Trace_PressCallBack : SimpleButton_Trace_ReleaseCallBack, now);
+        SIMPLEBTN_PROFILE_CALL(is_held ? SimpleButton_Prof_PressCallBack : SimpleButton_Prof_ReleaseCallBack, callBack());
+    }
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+
+#if SIMPLEBTN_MODE_ENABLE_COMBINATION != 0
+ #define SIMPLEBTN_STATE_MASK_DEBOUNCE_CMB      SIMPLEBTN_STATE_MASK(simpleButton_State_Combination_Release)
+#else
+ #define SIMPLEBTN_STATE_MASK_DEBOUNCE_CMB      0UL
+#endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
+ #define SIMPLEBTN_STATE_MASK_DEBOUNCE_HOLD     SIMPLEBTN_STATE_MASK(simpleButton_State_Hold_Release)
+#else
+ #define SIMPLEBTN_STATE_MASK_DEBOUNCE_HOLD     0UL
+#endif /* SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0 */
+
+/* States that debounce a release */
+#define SIMPLEBTN_STATE_MASK_DEBOUNCE_RELEASE                   \
+    ( SIMPLEBTN_STATE_MASK(simpleButton_State_Release_Delay)    \
+    | SIMPLEBTN_STATE_MASK_DEBOUNCE_CMB                         \
+    | SIMPLEBTN_STATE_MASK_DEBOUNCE_HOLD )
+
+/* States that wait for the debounce window */
+#define SIMPLEBTN_STATE_MASK_DEBOUNCE                           \
+    ( SIMPLEBTN_STATE_MASK(simpleButton_State_Push_Delay)       \
+    | SIMPLEBTN_STATE_MASK_DEBOUNCE_RELEASE )
+
+/* Measure the bounce during a debounce: the pin is sampled every tick, a level
+   against the one being debounced is a bounce. The window grows at once to the
+   latest bounce plus the margin, so the running debounce waits longer too. */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_DebounceSample(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint8_t is_pushed,
+    const uint32_t now
+) {
+    int32_t since;
+    uint32_t need;
+
+    if ((SIMPLEBTN_STATE_MASK(self_private->state) & SIMPLEBTN_STATE_MASK_DEBOUNCE_RELEASE) != 0) {
+        if (!is_pushed) {
+            return;
+        }
+        since = (int32_t)simpleButton_Private_Since(now, self_private->timeStamp_loop);
+    } else if ((simpleButton_Type_ButtonState_t)(self_private->state) == simpleButton_State_Push_Delay) {
+        if (is_pushed) {
+            return;
+        }
+        /* signed: the EXTI may stamp a tick newer than the snapshot `now` */
+        since = simpleButton_Private_SignedSince(now, self_private->timeStamp_interrupt);
+    } else {
+        return;
+    }
+
+    if (since < 0) {
+        return;
+    }
+    if (since >= (int32_t)SIMPLEBTN_DEBOUNCE_MAX) {
+        since = (int32_t)SIMPLEBTN_DEBOUNCE_MAX - 1;
+    }
+    self_private->bounce = (uint8_t)(since + 1);
+
+    need = (uint32_t)since + 1U + SIMPLEBTN_DEBOUNCE_MARGIN;
+    if (need > (uint32_t)self_private->debounce) {
+        self_private->debounce = (uint8_t)((need > SIMPLEBTN_DEBOUNCE_MAX) ? SIMPLEBTN_DEBOUNCE_MAX : need);
+    }
+}
+
+/* A debounce is over: move the window a quarter of the way down to the
+   bounce seen in it plus the margin (at least SIMPLEBTN_DEBOUNCE_MIN). */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_DebounceDone(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private
+) {
+    uint32_t target = (uint32_t)self_private->bounce + SIMPLEBTN_DEBOUNCE_MARGIN;
+
+    if (target < SIMPLEBTN_DEBOUNCE_MIN) {
+        target = SIMPLEBTN_DEBOUNCE_MIN;
+    }
+    if ((uint32_t)self_private->debounce > target) {
+        self_private->debounce -= (uint8_t)(((uint32_t)self_private->debounce - target + 3U) / 4U);
+    }
+    self_private->bounce = 0;
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
+/* Read the pin (at most once per pass) only if the current state needs it */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_ReadIsPushed(
+    const simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint32_t state_mask,
+    const simpleButton_Type_GPIOBase_t gpiox_base,
+    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
+    const simpleButton_Type_GPIOPinVal_t normal_pin_val
+) {
+    if ((SIMPLEBTN_STATE_MASK(self_private->state) & state_mask) == 0) {
+        return 0; /* the pin level is not used */
+    }
+
+    return (uint8_t)(SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) != normal_pin_val);
+}
+
+/* Earliest tick at which the State-Machine needs to run again (of current state) */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_NextDeadline(
+    const simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint32_t now
+) {
+    uint32_t deadline;
+
+    (void)self_public;
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+    if ((SIMPLEBTN_STATE_MASK(self_private->state) & SIMPLEBTN_STATE_MASK_DEBOUNCE) != 0) {
+        return now + 1; /* sample the bounce every tick */
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
+    switch ( (simpleButton_Type_ButtonState_t)(self_private->state) ) {
+    case simpleButton_State_Wait_For_Interrupt: {
+        return SIMPLEBTN__DEADLINE_NEVER; /* woken up by the interrupt */
+    }
+
+    case simpleButton_State_Push_Delay: {
+        deadline = now + (uint32_t)((int32_t)SIMPLEBTN_PUSH_DELAY(self_private) + 1
+            - simpleButton_Private_SignedSince(now, self_private->timeStamp_interrupt));
+        break;
+    }
+
+    case simpleButton_State_Wait_For_Repeat: {
+#if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
+        deadline = simpleButton_Private_StampTick(now, self_private->timeStamp_loop) + (uint32_t)self_public->repeatWindowTime + 1;
+#else
+        deadline = simpleButton_Private_StampTick(now, self_private->timeStamp_loop) + SIMPLEBTN_TIME_REPEAT_WINDOW + 1;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
+        break;
+    }
+
+    case simpleButton_State_Release_Delay: {
+        deadline = simpleButton_Private_StampTick(now, self_private->timeStamp_loop) + SIMPLEBTN_RELEASE_DELAY(self_private) + 1;
+        break;
+    }
+
+    case simpleButton_State_Cool_Down: {
+#if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
+        deadline = simpleButton_Private_StampTick(now, self_private->timeStamp_loop) + (uint32_t)self_public->coolDownTime + 1;
+#else
+        deadline = simpleButton_Private_StampTick(now, self_private->timeStamp_loop) + SIMPLEBTN_TIME_COOL_DOWN + 1;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
+        break;
+    }
+
+    /* the release is not reported by interrupt, poll the pin */
+    case simpleButton_State_Wait_For_End:
+#if SIMPLEBTN_MODE_ENABLE_COMBINATION != 0
+    case simpleButton_State_Combination_WaitForEnd:
+    case simpleButton_State_Combination_Release:
+#endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
+    {
+        deadline = now + SIMPLEBTN_TIME_POLL_INTERVAL;
+        break;
+    }
+
+#if SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
+
+    case simpleButton_State_Hold_Push: {
+        deadline = SimpleButton_EarlierDeadline(
+            simpleButton_Private_StampTick(now, self_private->timeStamp_loop) + SIMPLEBTN_TIME_HOLD_INTERVAL + 1,
+            now + SIMPLEBTN_TIME_POLL_INTERVAL
+        );
+        break;
+    }
+
+    case simpleButton_State_Hold_Release: {
+        deadline = simpleButton_Private_StampTick(now, self_private->timeStamp_loop) + SIMPLEBTN_RELEASE_DELAY(self_private) + 1;
+        break;
+    }
+
+#endif /* SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0 */
+
+    default: {
+        deadline = now; /* callback states, run again at once */
+        break;
+    }
+
+    } /* end switch */
+
+    /* never report a real deadline as "never" */
+    return (deadline == SIMPLEBTN__DEADLINE_NEVER) ? (deadline - 1) : deadline;
+}
+
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+
+/* Integrating debounce of a polled (dynamic) button: the debounced level
+   follows the pin once SIMPLEBTN_INTEGRATE_SAMPLES samples in a row disagree
+   with it, a single agreeing sample starts the count again. One sample is
+   taken per SIMPLEBTN_TIME_INTEGRATE_INTERVAL however often it is called.
+   States that do not read the pin keep the level. Return the debounced level. */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_Integrate(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint8_t is_pushed,
+    const uint32_t now
+) {
+    const uint8_t level = (uint8_t)((self_private->integrator & SIMPLEBTN_INTEGRATE_LEVEL) != 0);
+
+    if ((SIMPLEBTN_STATE_MASK(self_private->state) & SIMPLEBTN_STATE_MASK_POLL_PIN) == 0) {
+        return level; /* the pin is not read in this state */
+    }
+
+    if (simpleButton_Private_Since(now, self_private->timeStamp_sample) < SIMPLEBTN_TIME_INTEGRATE_INTERVAL) {
+        return level; /* not the time of the next sample */
+    }
+    self_private->timeStamp_sample = SIMPLEBTN_STAMP(now);
+
+    if (is_pushed == level) {
+        self_private->integrator &= SIMPLEBTN_INTEGRATE_LEVEL;
+        return level;
+    }
+
+    if ((uint32_t)(self_private->integrator & SIMPLEBTN_INTEGRATE_COUNT) + 1U >= SIMPLEBTN_INTEGRATE_SAMPLES) {
+        self_private->integrator = (uint8_t)(is_pushed ? SIMPLEBTN_INTEGRATE_LEVEL : 0U);
+        return is_pushed;
+    }
+
+    self_private->integrator ++;
+    return level;
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
+
+/* A polled (dynamic) button also needs to run to find the push */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_PolledDeadline(
+    const simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint32_t deadline,
+    const uint32_t now
+) {
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+    if (
+        (simpleButton_Type_ButtonState_t)(self_private->state) == simpleButton_State_Push_Delay
+        || (simpleButton_Type_ButtonState_t)(self_private->state) == simpleButton_State_Release_Delay
+    ) {
+        return now; /* the level is already debounced, finish at once */
+    }
+
+    if (
+        (self_private->integrator & SIMPLEBTN_INTEGRATE_COUNT) != 0
+        && (SIMPLEBTN_STATE_MASK(self_private->state) & SIMPLEBTN_STATE_MASK_POLL_PIN) != 0
+    ) {
+        return SimpleButton_EarlierDeadline(
+            deadline,
+            simpleButton_Private_StampTick(now, self_private->timeStamp_sample) + SIMPLEBTN_TIME_INTEGRATE_INTERVAL
+        );
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
+
+    if (
+        (simpleButton_Type_ButtonState_t)(self_private->state) == simpleButton_State_Wait_For_Interrupt
+        || (simpleButton_Type_ButtonState_t)(self_private->state) == simpleButton_State_Wait_For_Repeat
+    ) {
+        return SimpleButton_EarlierDeadline(deadline, now + SIMPLEBTN_TIME_POLL_INTERVAL);
+    }
+
+    return deadline;
+}
+
+#if SIMPLEBTN_MODE_ENABLE_COMPACT_STATE != 0
+
+/* Keep the 16-bit push stamp within one epoch of `now`, so the push time
+   stays exact while the handler runs at least every 32 seconds */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_CompactEpoch(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint32_t now
+) {
+    if (
+        (simpleButton_Type_ButtonState_t)(self_private->state) == simpleButton_State_Wait_For_Interrupt
+        || (simpleButton_Type_ButtonState_t)(self_private->state) == simpleButton_State_Wait_For_Repeat
+    ) {
+        return; /* the EXTI may write the stamp */
+    }
+
+    if (simpleButton_Private_Since(now, self_private->timeStamp_interrupt) < SIMPLEBTN_COMPACT_EPOCH_TICKS) {
+        return;
+    }
+
+    if (self_private->epoch < SIMPLEBTN_COMPACT_EPOCH_MAX) {
+        self_private->timeStamp_interrupt += (simpleButton_Type_TimeStamp_t)SIMPLEBTN_COMPACT_EPOCH_TICKS;
+        self_private->epoch ++;
+    } else {
+        /* saturate at SIMPLEBTN_COMPACT_PUSH_TIME_MAX */
+        self_private->timeStamp_interrupt = SIMPLEBTN_STAMP(now - (SIMPLEBTN_COMPACT_EPOCH_TICKS - 1));
+    }
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_COMPACT_STATE != 0 */
+
+/* The State-Machine shared by all kinds of buttons.
+   `is_debounced` is non-zero when `is_pushed` comes from a debounced snapshot.
+   `id` is the registry index in event-queue mode, or SIMPLEBTN_BUTTON_ID_NONE.
+   `now` is the tick snapshot of the current processing pass.
+   Return the next deadline of the button. */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_StateMachine(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint8_t is_pushed,
+    const uint8_t is_debounced,
+    const uint8_t id,
+    const uint32_t now,
+    simpleButton_Type_ShortPushCallBack_t shortPushCB,
+    simpleButton_Type_LongPushCallBack_t longPushCB,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCB
+) {
+    uint32_t deadline;
+#if SIMPLEBTN_MODE_ENABLE_TRACE != 0
+    uint8_t trace_state;
+#endif /* SIMPLEBTN_MODE_ENABLE_TRACE != 0 */
+#if SIMPLEBTN_MODE_ENABLE_PROFILING != 0
+    uint8_t prof_state;
+    uint32_t prof_start;
+#endif /* SIMPLEBTN_MODE_ENABLE_PROFILING != 0 */
+#if SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0
+    uint8_t press_state;
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0 */
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+    uint8_t debounce_state;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
 
+#if SIMPLEBTN_MODE_ENABLE_COMPACT_STATE != 0
+    simpleButton_Private_CompactEpoch(self_private, now);
+#endif /* SIMPLEBTN_MODE_ENABLE_COMPACT_STATE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_TRACE != 0
+    trace_state = (uint8_t)(self_private->state);
+#endif /* SIMPLEBTN_MODE_ENABLE_TRACE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0
+    press_state = (uint8_t)(self_private->state);
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+    debounce_state = (uint8_t)(self_private->state);
+    if (!is_debounced) {
+        simpleButton_Private_DebounceSample(self_private, is_pushed, now);
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_PROFILING != 0
+    prof_state = (uint8_t)(self_private->state);
+    simpleButton_ProfCallbackCycles = 0;
+    prof_start = SIMPLEBTN_FUNC_GET_CYCLE();
+#endif /* SIMPLEBTN_MODE_ENABLE_PROFILING != 0 */
+
     switch ( (simpleButton_Type_ButtonState_t)(self_private->state) ) {
     case simpleButton_State_Wait_For_Interrupt: {
         simpleButton_Private_StateWaitForInterrupt_Handler();
@@ -536,54 +1529,55 @@ simpleButton_Private_AsynchronousHandler(
     }
 
     case simpleButton_State_Push_Delay: {
-        simpleButton_Private_StatePushDelay_Handler(self_private, gpiox_base, gpio_pin_x, normal_pin_val);
+        simpleButton_Private_StatePushDelay_Handler(self_private, is_pushed, is_debounced, now);
         break;
     }
 
     case simpleButton_State_Wait_For_End: {
-        simpleButton_Private_StateWaitForEnd_Handler(self_private, self_public, gpiox_base, gpio_pin_x, normal_pin_val);
+        simpleButton_Private_StateWaitForEnd_Handler(self_private, self_public, is_pushed, now);
         break;
     }
 
     case simpleButton_State_Wait_For_Repeat: {
-        simpleButton_Private_StateWaitForRepeat_Handler(self_private, self_public);
+        simpleButton_Private_StateWaitForRepeat_Handler(self_private, self_public, now);
         break;
     }
 
     case simpleButton_State_Single_Push: {
-        simpleButton_Private_StateSinglePush_Handler(self_private, self_public, shortPushCB, longPushCB);
+        simpleButton_Private_StateSinglePush_Handler(self_private, self_public, shortPushCB, longPushCB, id, now);
         break;
     }
 
     case simpleButton_State_Repeat_Push: {
-        simpleButton_Private_StateRepeatPush_Handler(self_private, repeatPushCB);
+        simpleButton_Private_StateRepeatPush_Handler(self_private, repeatPushCB, id, now);
         break;
     }
 
     case simpleButton_State_Release_Delay: {
-        simpleButton_Private_StateReleaseDelay_Handler(self_private, self_public, gpiox_base, gpio_pin_x, normal_pin_val);
+        simpleButton_Private_StateReleaseDelay_Handler(self_private, self_public, is_pushed, is_debounced,
+            simpleButton_Private_NoRepeatWindow(self_public, repeatPushCB, id), now);
         break;
     }
 
     case simpleButton_State_Cool_Down: {
-        simpleButton_Private_StateCoolDown_Handler(self_private, self_public);
+        simpleButton_Private_StateCoolDown_Handler(self_private, self_public, now);
         break;
     }
 
 #if SIMPLEBTN_MODE_ENABLE_COMBINATION != 0
 
     case simpleButton_State_Combination_Push: {
-        simpleButton_Private_StateCombinationPush_Handler(self_private, self_public);
+        simpleButton_Private_StateCombinationPush_Handler(self_private, self_public, id, now);
         break;
     }
 
     case simpleButton_State_Combination_WaitForEnd: {
-        simpleButton_Private_StateCombinationWaitForEnd_Handler(self_private, gpiox_base, gpio_pin_x, normal_pin_val);
+        simpleButton_Private_StateCombinationWaitForEnd_Handler(self_private, is_pushed, now);
         break;
     }
 
     case simpleButton_State_Combination_Release: {
-        simpleButton_Private_StateCombinationRelease_Handler(self_private, gpiox_base, gpio_pin_x, normal_pin_val);
+        simpleButton_Private_StateCombinationRelease_Handler(self_private, is_pushed, now);
         break;
     }
 
@@ -592,12 +1586,12 @@ simpleButton_Private_AsynchronousHandler(
 #if SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
 
     case simpleButton_State_Hold_Push: {
-        simpleButton_Private_StateHoldPush_Handler(self_private, gpiox_base, gpio_pin_x, normal_pin_val, longPushCB);
+        simpleButton_Private_StateHoldPush_Handler(self_private, is_pushed, longPushCB, id, now);
         break;
     }
 
     case simpleButton_State_Hold_Release: {
-        simpleButton_Private_StateHoldRelease_Handler(self_private, gpiox_base, gpio_pin_x, normal_pin_val);
+        simpleButton_Private_StateHoldRelease_Handler(self_private, is_pushed, now);
         break;
     } 
 
@@ -610,7 +1604,157 @@ simpleButton_Private_AsynchronousHandler(
 
     } /* end switch */
 
+#if SIMPLEBTN_MODE_ENABLE_PROFILING != 0
+    if (prof_state < simpleButton_State_Count) {
+        const uint32_t prof_cycles = SIMPLEBTN_FUNC_GET_CYCLE() - prof_start - simpleButton_ProfCallbackCycles;
+
+        simpleButton_Private_ProfAdd(&(simpleButton_ProfSite[SimpleButton_Prof_State + prof_state]), prof_cycles);
+        simpleButton_Private_ProfAdd(&(self_public->profile), prof_cycles);
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_PROFILING != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_TRACE != 0
+    if ((uint8_t)(self_private->state) != trace_state) {
+        SIMPLEBTN_TRACE_M(self_private, SimpleButton_Trace_Transition, self_private->state, now);
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_TRACE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+    if (
+        (uint8_t)(self_private->state) != debounce_state
+        && (SIMPLEBTN_STATE_MASK(debounce_state) & SIMPLEBTN_STATE_MASK_DEBOUNCE) != 0
+    ) {
+        simpleButton_Private_DebounceDone(self_private);
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0
+    simpleButton_Private_PressEvent(self_private, self_public, press_state, id, now);
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0 */
+
+    deadline = simpleButton_Private_NextDeadline(self_private, self_public, now);
+
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
+
+    return deadline;
+}
+
+#if SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0
+
+/* States in which the EXTI line of a button is armed */
+#define SIMPLEBTN_STATE_MASK_EXTI_ARMED                             \
+    ( SIMPLEBTN_STATE_MASK(simpleButton_State_Wait_For_Interrupt)   \
+    | SIMPLEBTN_STATE_MASK(simpleButton_State_Wait_For_Repeat) )
+
+/* States that have just seen the pin released before waiting for an edge */
+#define SIMPLEBTN_STATE_MASK_EXTI_RELEASED                          \
+    ( SIMPLEBTN_STATE_MASK(simpleButton_State_Push_Delay)           \
+    | SIMPLEBTN_STATE_MASK(simpleButton_State_Release_Delay) )
+
+/* Re-arm the EXTI line masked by the interrupt handler, once the State-Machine
+   waits for an edge again. When leaving Push_Delay or Release_Delay, the pin
+   was released in this pass, so a push seen after re-arming is a new edge that
+   the masked line missed. (A push during Cool_Down is still ignored.)
+   `state_before` is the state before this pass. Return the next deadline. */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_ExtiRearm(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint8_t state_before,
+    const simpleButton_Type_GPIOBase_t gpiox_base,
+    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
+    const simpleButton_Type_GPIOPinVal_t normal_pin_val,
+    const uint32_t deadline,
+    const uint32_t now
+) {
+    if (
+        (SIMPLEBTN_STATE_MASK(state_before) & SIMPLEBTN_STATE_MASK_EXTI_ARMED) != 0
+        || (SIMPLEBTN_STATE_MASK(self_private->state) & SIMPLEBTN_STATE_MASK_EXTI_ARMED) == 0
+    ) {
+        return deadline; /* the line is still armed, or still masked */
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    SIMPLEBTN_FUNC_EXTI_UNMASK(gpio_pin_x); /* the stale pending flag is cleared */
+
+    if (
+        (SIMPLEBTN_STATE_MASK(state_before) & SIMPLEBTN_STATE_MASK_EXTI_RELEASED) == 0
+        || SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) == normal_pin_val
+    ) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+        return deadline;
+    }
+
+    /* pushed again while masked, take the level as the edge */
+    simpleButton_Private_StampPush(self_private, now);
+    self_private->state = simpleButton_State_Push_Delay;
+    SIMPLEBTN_FUNC_EXTI_MASK(gpio_pin_x);
+    SIMPLEBTN_TRACE_ISR(self_private, SimpleButton_Trace_Transition, simpleButton_State_Push_Delay, now);
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+
+    return now;
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0 */
+
+/**
+ * @brief           Asynchronously call the callback function in while loop.
+ * @param[inout]    self_private - pointer to self.Private struct.
+ * @param[inout]    self_public - pointer to self.Public struct.
+ * @param[in]       gpiox_base - Address of GPIO port connected to the button.
+ * @param[in]       gpio_pin_x - GPIO pin number connected to the button.
+ * @param[in]       normal_pin_val - Normal(didn't push) pin value of button pin. (can be 1 or 0)
+ * @param[in]       now - The tick snapshot of this pass (`SIMPLEBTN_FUNC_GET_TICK()`).
+ * @param[in]       shortPushCB - callback function for short push.
+ * @param[in]       longPushCB - callback function for long push.
+ * @param[in]       repeatPushCB - callback function for repeat push.
+ * @return          The tick at which the handler needs to run again,
+ *                  or `SIMPLEBTN__DEADLINE_NEVER` if it waits for the interrupt.
+ */
+SIMPLEBTN_C_API HOT_ uint32_t
+simpleButton_Private_AsynchronousHandler(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const simpleButton_Type_GPIOBase_t gpiox_base,
+    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
+    const simpleButton_Type_GPIOPinVal_t normal_pin_val,
+    const uint32_t now,
+    simpleButton_Type_ShortPushCallBack_t shortPushCB,
+    simpleButton_Type_LongPushCallBack_t longPushCB,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCB
+) {
+    uint32_t deadline;
+
+#if SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0
+    const uint8_t state_before = self_private->state;
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0 */
+
+    deadline = simpleButton_Private_StateMachine(
+        self_private,
+        self_public,
+        simpleButton_Private_ReadIsPushed(
+            self_private,
+            SIMPLEBTN_STATE_MASK_READ_PIN,
+            gpiox_base,
+            gpio_pin_x,
+            normal_pin_val
+        ),
+        0,
+        SIMPLEBTN_BUTTON_ID_NONE,
+        now,
+        shortPushCB,
+        longPushCB,
+        repeatPushCB
+    );
+
+#if SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0
+    deadline = simpleButton_Private_ExtiRearm(
+        self_private, state_before, gpiox_base, gpio_pin_x, normal_pin_val, deadline, now
+    );
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0 */
+
+    return deadline;
 }
 
 /**
@@ -644,57 +1788,1420 @@ SimpleButton_DynamicButton_Init(
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
 }
 
+/* Polling replaces the EXTI of dynamic-button */
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_DynamicBtn_CheckState(
-    SimpleButton_Type_DynamicBtn_t* const self
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint8_t is_pushed,
+    const uint32_t now
 ) {
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
 
     if (
-        (simpleButton_Type_ButtonState_t)(self->Private.state) != simpleButton_State_Wait_For_Interrupt
-        && (simpleButton_Type_ButtonState_t)(self->Private.state) != simpleButton_State_Wait_For_Repeat
+        (simpleButton_Type_ButtonState_t)(self_private->state) != simpleButton_State_Wait_For_Interrupt
+        && (simpleButton_Type_ButtonState_t)(self_private->state) != simpleButton_State_Wait_For_Repeat
     ) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
         return; /* WFI or WFR is needed */
     }
 
-    if (SIMPLEBTN_FUNC_READ_PIN(self->GPIO_Base, self->GPIO_Pin) == self->normalPinVal) {
+    if (!is_pushed) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
         return; /* didn't be pushed */
     }
 
-    self->Private.timeStamp_interrupt = SIMPLEBTN_FUNC_GET_TICK();
-    self->Private.state = simpleButton_State_Push_Delay;
+    simpleButton_Private_StampPush(self_private, now);
+    self_private->state = simpleButton_State_Push_Delay;
+    SIMPLEBTN_TRACE_ISR(self_private, SimpleButton_Trace_Transition, simpleButton_State_Push_Delay, now);
 
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
 }
 
 /**
- * @brief           Handler of dynamic-button.
+ * @brief           Handler of dynamic-button, with the tick given by caller.
  * 
  * @param[inout]    self - The pointer of dynamic-button object.
+ * @param[in]       now - The tick snapshot of this pass (`SIMPLEBTN_FUNC_GET_TICK()`).
+ *                  Read it once and pass it to the handlers of all buttons.
  * @param[in]       shortPushCallBack - callback function for short push.
  * @param[in]       longPushCallBack - callback function for long push.
  * @param[in]       repeatPushCallBack - callback function for repeat push.
  * 
- * @return          None
+ * @return          The tick at which the handler needs to run again.
  */
-SIMPLEBTN_C_API HOT_ void
-SimpleButton_DynamicButton_Handler(
+SIMPLEBTN_C_API HOT_ uint32_t
+SimpleButton_DynamicButton_HandlerAt(
     SimpleButton_Type_DynamicBtn_t* const self,
+    const uint32_t now,
     simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
     simpleButton_Type_LongPushCallBack_t longPushCallBack,
     simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
 ) {
-
-    simpleButton_Private_DynamicBtn_CheckState(self);
-
-    simpleButton_Private_AsynchronousHandler(
+    /* one pin read serves both the polling and the State-Machine */
+    uint8_t is_pushed = simpleButton_Private_ReadIsPushed(
         &(self->Private),
-        &(self->Public),
+        SIMPLEBTN_STATE_MASK_POLL_PIN,
+        self->GPIO_Base,
+        self->GPIO_Pin,
+        self->normalPinVal
+    );
+
+    uint32_t deadline;
+
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+    is_pushed = simpleButton_Private_Integrate(&(self->Private), is_pushed, now);
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
+
+    simpleButton_Private_DynamicBtn_CheckState(&(self->Private), is_pushed, now);
+
+    deadline = simpleButton_Private_StateMachine(
+        &(self->Private),
+        &(self->Public),
+        is_pushed,
+        SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0,
+        SIMPLEBTN_BUTTON_ID_NONE,
+        now,
+        shortPushCallBack,
+        longPushCallBack,
+        repeatPushCallBack
+    );
+
+    return simpleButton_Private_PolledDeadline(&(self->Private), deadline, now);
+}
+
+/**
+ * @brief           Handler of dynamic-button.
+ * 
+ * @param[inout]    self - The pointer of dynamic-button object.
+ * @param[in]       shortPushCallBack - callback function for short push.
+ * @param[in]       longPushCallBack - callback function for long push.
+ * @param[in]       repeatPushCallBack - callback function for repeat push.
+ * 
+ * @return          The tick at which the handler needs to run again.
+ */
+SIMPLEBTN_C_API HOT_ uint32_t
+SimpleButton_DynamicButton_Handler(
+    SimpleButton_Type_DynamicBtn_t* const self,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+) {
+    return SimpleButton_DynamicButton_HandlerAt(
+        self,
+        SIMPLEBTN_FUNC_GET_TICK(),
+        shortPushCallBack,
+        longPushCallBack,
+        repeatPushCallBack
+    );
+}
+
+
+#if SIMPLEBTN_MODE_ENABLE_BUTTON_TABLE != 0
+
+/**
+ * @brief           Initialize the EXTI of all the buttons of a button table.
+ * 
+ * @param[in]       table - The button table created by `SIMPLEBTN__TABLE_CREATE`.
+ * 
+ * @note            The status of the buttons is constant-initialized, only the
+ *                  adaptive debounce window is set here.
+ *                  If `SIMPLEBTN_FUNC_INIT_EXTI_PORT` and `SIMPLEBTN_FUNC_INIT_EXTI_NVIC`
+ *                  are defined, the buttons are grouped by port: each port is
+ *                  initialized once and each NVIC channel is enabled once.
+ * 
+ * @return          None
+ */
+SIMPLEBTN_C_API void SimpleButton_Table_Init(const SimpleButton_Type_BtnTable_t* const table)
+{
+    uint8_t id;
+
+#if defined(SIMPLEBTN_FUNC_INIT_EXTI_PORT) && defined(SIMPLEBTN_FUNC_INIT_EXTI_NVIC)
+
+    uint8_t other;
+    uint32_t exti_lines = 0;
+
+    for (id = 0; id < table->count; id++) {
+        simpleButton_Type_GPIOPin_t pins_falling = 0;
+        simpleButton_Type_GPIOPin_t pins_rising = 0;
+
+#if SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0
+        simpleButton_Private_ExtiAttach(&(table->buttons[id].Private), table->config[id].gpio_pin_x);
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+        /* the status is constant-initialized to 0, start safe like `simpleButton_Private_InitStructPrivate` */
+        table->buttons[id].Private.debounce = SIMPLEBTN_DEBOUNCE_MAX;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
+        /* the EXTI line of a pin is its pin mask */
+        exti_lines |= table->config[id].gpio_pin_x;
+
+        for (other = 0; other < id; other++) {
+            if (table->config[other].gpiox_base == table->config[id].gpiox_base) {
+                break;
+            }
+        }
+        if (other != id) {
+            continue; /* this port has been initialized */
+        }
+
+        for (other = id; other < table->count; other++) {
+            if (table->config[other].gpiox_base != table->config[id].gpiox_base) {
+                continue;
+            }
+            if (
+                (simpleButton_Type_EXTITrigger_t)(table->config[other].exti_trigger)
+                == SIMPLEBTN_EXTI_TRIGGER_FALLING
+            ) {
+                pins_falling |= table->config[other].gpio_pin_x;
+            } else {
+                pins_rising |= table->config[other].gpio_pin_x;
+            }
+        }
+
+        SIMPLEBTN_FUNC_INIT_EXTI_PORT(table->config[id].gpiox_base, pins_falling, pins_rising);
+    }
+
+    SIMPLEBTN_FUNC_INIT_EXTI_NVIC(exti_lines);
+
+#else
+
+    for (id = 0; id < table->count; id++) {
+#if SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0
+        simpleButton_Private_ExtiAttach(&(table->buttons[id].Private), table->config[id].gpio_pin_x);
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+        /* the status is constant-initialized to 0, start safe like `simpleButton_Private_InitStructPrivate` */
+        table->buttons[id].Private.debounce = SIMPLEBTN_DEBOUNCE_MAX;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
+        SIMPLEBTN_FUNC_INIT_EXTI(
+            table->config[id].gpiox_base,
+            table->config[id].gpio_pin_x,
+            (simpleButton_Type_EXTITrigger_t)(table->config[id].exti_trigger)
+        );
+    }
+
+#endif /* defined(SIMPLEBTN_FUNC_INIT_EXTI_PORT) && defined(SIMPLEBTN_FUNC_INIT_EXTI_NVIC) */
+}
+
+/**
+ * @brief           The interrupt entry shared by all the buttons of a table.
+ *                  Call it in the EXTI interrupt service routine.
+ * 
+ * @param[in]       table - The button table.
+ * @param[in]       id - The id of the button (`prefix/namespace` + name + `_ID`).
+ * 
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_Table_InterruptHandler(const SimpleButton_Type_BtnTable_t* const table, const uint8_t id)
+{
+    simpleButton_Private_InterruptHandler(&(table->buttons[id].Private), table->config[id].gpio_pin_x);
+}
+
+/**
+ * @brief           The handler shared by all the buttons of a table, with the
+ *                  tick given by caller.
+ * 
+ * @param[in]       table - The button table.
+ * @param[in]       id - The id of the button (`prefix/namespace` + name + `_ID`).
+ * @param[in]       now - The tick snapshot of this pass (`SIMPLEBTN_FUNC_GET_TICK()`).
+ * @param[in]       shortPushCallBack - callback function for short push.
+ * @param[in]       longPushCallBack - callback function for long push.
+ * @param[in]       repeatPushCallBack - callback function for repeat push.
+ * 
+ * @return          The tick at which the handler needs to run again,
+ *                  or `SIMPLEBTN__DEADLINE_NEVER` if it waits for the interrupt.
+ */
+SIMPLEBTN_C_API HOT_ uint32_t
+SimpleButton_Table_HandlerAt(
+    const SimpleButton_Type_BtnTable_t* const table,
+    const uint8_t id,
+    const uint32_t now,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+) {
+    const simpleButton_Type_TableConfig_t* const config = &(table->config[id]);
+
+    return simpleButton_Private_AsynchronousHandler(
+        &(table->buttons[id].Private),
+        &(table->buttons[id].Public),
+        config->gpiox_base,
+        config->gpio_pin_x,
+        config->normal_pin_val,
+        now,
+        shortPushCallBack,
+        longPushCallBack,
+        repeatPushCallBack
+    );
+}
+
+/**
+ * @brief           The handler shared by all the buttons of a table.
+ * 
+ * @param[in]       table - The button table.
+ * @param[in]       id - The id of the button (`prefix/namespace` + name + `_ID`).
+ * @param[in]       shortPushCallBack - callback function for short push.
+ * @param[in]       longPushCallBack - callback function for long push.
+ * @param[in]       repeatPushCallBack - callback function for repeat push.
+ * 
+ * @return          Same as `SimpleButton_Table_HandlerAt()`.
+ */
+SIMPLEBTN_C_API HOT_ uint32_t
+SimpleButton_Table_Handler(
+    const SimpleButton_Type_BtnTable_t* const table,
+    const uint8_t id,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+) {
+    return SimpleButton_Table_HandlerAt(
+        table,
+        id,
+        SIMPLEBTN_FUNC_GET_TICK(),
+        shortPushCallBack,
+        longPushCallBack,
+        repeatPushCallBack
+    );
+}
+
+/**
+ * @brief           Check whether all the buttons of a table are idle
+ *                  (Wait For Interrupt), e.g. before entering low-power mode.
+ * 
+ * @param[in]       table - The button table.
+ * 
+ * @return          1 if all are idle, otherwise 0.
+ */
+SIMPLEBTN_C_API uint8_t SimpleButton_Table_IsIdle(const SimpleButton_Type_BtnTable_t* const table)
+{
+    uint8_t id;
+
+    for (id = 0; id < table->count; id++) {
+        if (
+            (simpleButton_Type_ButtonState_t)(table->buttons[id].Private.state)
+            != simpleButton_State_Wait_For_Interrupt
+        ) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+
+/**
+ * @brief           Add a button of a table to the registry, so that it is
+ *                  handled by `SimpleButton_ProcessAll()`.
+ * 
+ * @param[in]       table - The button table.
+ * @param[in]       id - The id of the button in the table.
+ * @param[in]       shortPushCallBack - callback function for short push.
+ * @param[in]       longPushCallBack - callback function for long push.
+ * @param[in]       repeatPushCallBack - callback function for repeat push.
+ * 
+ * @return          The id (registry index) of the button,
+ *                  or `SIMPLEBTN_REGISTRY_INVALID_ID` if the registry is full.
+ */
+SIMPLEBTN_C_API uint8_t
+SimpleButton_Table_Register(
+    const SimpleButton_Type_BtnTable_t* const table,
+    const uint8_t id,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+) {
+    return simpleButton_Private_RegistryAdd(
+        &(table->buttons[id].Private),
+        &(table->buttons[id].Public),
+        table->config[id].gpiox_base,
+        table->config[id].gpio_pin_x,
+        table->config[id].normal_pin_val,
+        0,
+        shortPushCallBack,
+        longPushCallBack,
+        repeatPushCallBack
+    );
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
+
+#endif /* SIMPLEBTN_MODE_ENABLE_BUTTON_TABLE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_MATRIX != 0 || SIMPLEBTN_MODE_ENABLE_LADDER != 0
+
+/**
+ * @brief           The handler of a key read by a scan (matrix / ladder)
+ *                  instead of its own pin: polled like a dynamic-button.
+ * 
+ * @param[in,out]   self_private / self_public - The status of the key.
+ * @param[in]       is_pushed - The level of the key in the last scan
+ *                  (the integrated level is used instead with the integrating debounce).
+ * @param[in]       now - The tick snapshot of this pass.
+ * @param[in]       shortPushCallBack / longPushCallBack / repeatPushCallBack - The callbacks.
+ * 
+ * @return          The tick at which the handler needs to run again.
+ */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_ScannedKeyHandlerAt(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    uint8_t is_pushed,
+    const uint32_t now,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+) {
+    uint32_t deadline;
+
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+    /* integrated by the scan function at its interval, not once per call */
+    is_pushed = (uint8_t)((self_private->integrator & SIMPLEBTN_INTEGRATE_LEVEL) != 0);
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
+
+    simpleButton_Private_DynamicBtn_CheckState(self_private, is_pushed, now);
+
+    deadline = simpleButton_Private_StateMachine(
+        self_private,
+        self_public,
+        is_pushed,
+        SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0,
+        SIMPLEBTN_BUTTON_ID_NONE,
+        now,
+        shortPushCallBack,
+        longPushCallBack,
+        repeatPushCallBack
+    );
+
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+    if ((simpleButton_Type_ButtonState_t)(self_private->state) == simpleButton_State_Release_Delay) {
+        return now; /* the level is already debounced, finish at once */
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
+
+    return deadline;
+}
+
+/**
+ * @brief           Check whether a key read by a scan is idle.
+ * 
+ * @param[in]       self_private - The status of the key.
+ * 
+ * @return          1 if it is idle, otherwise 0.
+ */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_ScannedKeyIsIdle(const simpleButton_Type_PrivateBtnStatus_t* const self_private)
+{
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+    if ((self_private->integrator & SIMPLEBTN_INTEGRATE_COUNT) != 0) {
+        return 0; /* still counting the samples of a change */
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
+
+    return (uint8_t)(
+        (simpleButton_Type_ButtonState_t)(self_private->state) == simpleButton_State_Wait_For_Interrupt
+    );
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_MATRIX != 0 || SIMPLEBTN_MODE_ENABLE_LADDER != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_MATRIX != 0
+
+/**
+ * @brief           Initialize the pins and the keys of a key matrix.
+ * 
+ * @param[in]       matrix - The key matrix created by `SIMPLEBTN__MATRIX_CREATE`.
+ * 
+ * @note            With `__extiWake`, the columns are also routed to their EXTI
+ *                  lines (falling edge). The EXTI interrupt service routine
+ *                  of these lines calls `SimpleButton_Matrix_InterruptHandler()`.
+ * 
+ * @return          None
+ */
+SIMPLEBTN_C_API void SimpleButton_Matrix_Init(const SimpleButton_Type_Matrix_t* const matrix)
+{
+    uint16_t index; /* a 16 x 16 matrix has 256 keys */
+
+    SIMPLEBTN_FUNC_INIT_MATRIX(matrix->row_base, matrix->row_mask, matrix->col_base, matrix->col_mask);
+
+    for (index = 0; index < matrix->row_num * matrix->col_num; index++) {
+        simpleButton_Private_InitStructPrivate(&(matrix->keys[index].Private));
+        simpleButton_Private_InitStructPublic(&(matrix->keys[index].Public));
+    }
+    for (index = 0; index < matrix->row_num; index++) {
+        matrix->pushed[index] = 0;
+    }
+    matrix->status->woken = 0;
+    matrix->status->parked = 0;
+    matrix->status->ghost = 0;
+
+    if (matrix->exti_wake == 0) {
+        return;
+    }
+
+#if defined(SIMPLEBTN_FUNC_INIT_EXTI_PORT) && defined(SIMPLEBTN_FUNC_INIT_EXTI_NVIC)
+    SIMPLEBTN_FUNC_INIT_EXTI_PORT(matrix->col_base, matrix->col_mask, 0);
+    SIMPLEBTN_FUNC_INIT_EXTI_NVIC(matrix->col_mask);
+#else
+    for (index = 0; index < matrix->col_num; index++) {
+        SIMPLEBTN_FUNC_INIT_EXTI(matrix->col_base, matrix->col_pins[index], SIMPLEBTN_EXTI_TRIGGER_FALLING);
+    }
+#endif /* defined(SIMPLEBTN_FUNC_INIT_EXTI_PORT) && defined(SIMPLEBTN_FUNC_INIT_EXTI_NVIC) */
+}
+
+/**
+ * @brief           The interrupt entry of the column EXTI lines of a key matrix
+ *                  (only with `__extiWake`). Call it in the EXTI interrupt
+ *                  service routine, then clear the pending bit as usual.
+ * 
+ * @param[in]       matrix - The key matrix.
+ * 
+ * @return          None
+ */
+SIMPLEBTN_C_API void SimpleButton_Matrix_InterruptHandler(const SimpleButton_Type_Matrix_t* const matrix)
+{
+    matrix->status->woken = 1;
+}
+
+/**
+ * @brief           Scan a key matrix: drive each row low in turn and read all
+ *                  the columns at once (one port write and one port read per
+ *                  row). Call it once per pass, before the handlers of its keys.
+ * 
+ * @param[in]       matrix - The key matrix.
+ * @param[in]       now - The tick snapshot of this pass (`SIMPLEBTN_FUNC_GET_TICK()`).
+ * 
+ * @note            Without diodes, three pushed keys on the corners of a
+ *                  rectangle also show the fourth one. So when two rows share
+ *                  two or more pushed columns, these rows keep the keys they
+ *                  had and report no new push until the ghost is gone
+ *                  (`status->ghost` shows the blocked rows).
+ * 
+ * @return          The tick at which the scan needs to run again, or
+ *                  `SIMPLEBTN__DEADLINE_NEVER` if the rows are parked and
+ *                  the column EXTI wakes it up.
+ */
+SIMPLEBTN_C_API HOT_ uint32_t
+SimpleButton_Matrix_ScanAt(const SimpleButton_Type_Matrix_t* const matrix, const uint32_t now)
+{
+    simpleButton_Type_MatrixStatus_t* const status = matrix->status;
+    simpleButton_Type_GPIOPin_t raw[16]; /* the rows are pins of one port */
+    uint16_t ghost = 0;
+    uint32_t interval = SIMPLEBTN_TIME_MATRIX_SCAN;
+    uint8_t busy = 0;
+    uint8_t row, other;
+    uint16_t key; /* a 16 x 16 matrix has 256 keys */
+
+    if (status->parked != 0 && status->woken == 0) {
+        return SIMPLEBTN__DEADLINE_NEVER; /* idle, woken up by the column EXTI */
+    }
+    status->parked = 0;
+
+    for (row = 0; row < matrix->row_num; row++) {
+        SIMPLEBTN_FUNC_WRITE_PORT(
+            matrix->row_base,
+            (simpleButton_Type_GPIOPin_t)(matrix->row_mask & ~matrix->row_pins[row]),
+            matrix->row_pins[row]
+        );
+        SIMPLEBTN_FUNC_MATRIX_SETTLE();
+        raw[row] = (simpleButton_Type_GPIOPin_t)(~(uint32_t)SIMPLEBTN_FUNC_READ_PORT(matrix->col_base) & matrix->col_mask);
+    }
+    SIMPLEBTN_FUNC_WRITE_PORT(matrix->row_base, matrix->row_mask, 0); /* release all rows */
+
+    /* two rows sharing two pushed columns may show a ghost key */
+    for (row = 0; row < matrix->row_num; row++) {
+        for (other = row + 1; other < matrix->row_num; other++) {
+            const simpleButton_Type_GPIOPin_t shared = (simpleButton_Type_GPIOPin_t)(raw[row] & raw[other]);
+
+            if ((shared & (shared - 1U)) != 0) {
+                ghost |= (uint16_t)((1U << row) | (1U << other));
+            }
+        }
+    }
+
+    /* a blocked row may release its keys, but not push new ones */
+    for (row = 0; row < matrix->row_num; row++) {
+        if (((ghost >> row) & 1U) != 0) {
+            matrix->pushed[row] &= raw[row];
+        } else {
+            matrix->pushed[row] = raw[row];
+        }
+        busy |= (uint8_t)(matrix->pushed[row] != 0);
+    }
+    status->ghost = ghost;
+
+    for (key = 0; key < matrix->row_num * matrix->col_num; key++) {
+        simpleButton_Type_PrivateBtnStatus_t* const self_private = &(matrix->keys[key].Private);
+
+        busy |= (uint8_t)((simpleButton_Type_ButtonState_t)(self_private->state) != simpleButton_State_Wait_For_Interrupt);
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+        /* a scan is a sample of each key, at most one per SIMPLEBTN_TIME_INTEGRATE_INTERVAL */
+        (void)simpleButton_Private_Integrate(
+            self_private,
+            (uint8_t)((matrix->pushed[key / matrix->col_num] & matrix->col_pins[key % matrix->col_num]) != 0),
+            now
+        );
+        if ((self_private->integrator & SIMPLEBTN_INTEGRATE_COUNT) != 0) {
+            busy = 1;
+            interval = SIMPLEBTN_TIME_INTEGRATE_INTERVAL; /* the key counts a change */
+        }
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
+    }
+
+    if (busy != 0) {
+        return now + interval;
+    }
+
+    if (matrix->exti_wake == 0) {
+        return now + SIMPLEBTN_TIME_POLL_INTERVAL;
+    }
+
+    /* park all rows low, a push pulls its column low and wakes up the scan */
+    SIMPLEBTN_FUNC_WRITE_PORT(matrix->row_base, 0, matrix->row_mask);
+    SIMPLEBTN_FUNC_MATRIX_SETTLE();
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    SIMPLEBTN_FUNC_EXTI_CLEAR_PENDING(matrix->col_mask); /* the edges made by the scan */
+    status->parked = 1;
+    /* a key pushed after its row was read has no edge left */
+    status->woken = (uint8_t)((~(uint32_t)SIMPLEBTN_FUNC_READ_PORT(matrix->col_base) & matrix->col_mask) != 0);
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+
+    return (status->woken != 0) ? now : SIMPLEBTN__DEADLINE_NEVER;
+}
+
+/**
+ * @brief           The handler shared by all the keys of a matrix, run on the
+ *                  result of the last `SimpleButton_Matrix_ScanAt()`.
+ * 
+ * @param[in]       matrix - The key matrix.
+ * @param[in]       key - The id of the key (row * col_num + col).
+ * @param[in]       now - The tick snapshot of this pass (`SIMPLEBTN_FUNC_GET_TICK()`).
+ * @param[in]       shortPushCallBack - callback function for short push.
+ * @param[in]       longPushCallBack - callback function for long push.
+ * @param[in]       repeatPushCallBack - callback function for repeat push.
+ * 
+ * @return          The tick at which the handler needs to run again,
+ *                  or `SIMPLEBTN__DEADLINE_NEVER` if it waits for a push.
+ */
+SIMPLEBTN_C_API HOT_ uint32_t
+SimpleButton_Matrix_HandlerAt(
+    const SimpleButton_Type_Matrix_t* const matrix,
+    const uint8_t key,
+    const uint32_t now,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+) {
+    SimpleButton_Type_MatrixKey_t* const self = &(matrix->keys[key]);
+
+    return simpleButton_Private_ScannedKeyHandlerAt(
+        &(self->Private),
+        &(self->Public),
+        (uint8_t)((matrix->pushed[key / matrix->col_num] & matrix->col_pins[key % matrix->col_num]) != 0),
+        now,
+        shortPushCallBack,
+        longPushCallBack,
+        repeatPushCallBack
+    );
+}
+
+/**
+ * @brief           Check whether all the keys of a matrix are idle and
+ *                  released, e.g. before entering low-power mode.
+ * 
+ * @param[in]       matrix - The key matrix.
+ * 
+ * @return          1 if all are idle, otherwise 0.
+ */
+SIMPLEBTN_C_API uint8_t SimpleButton_Matrix_IsIdle(const SimpleButton_Type_Matrix_t* const matrix)
+{
+    uint16_t index; /* a 16 x 16 matrix has 256 keys */
+
+    for (index = 0; index < matrix->row_num; index++) {
+        if (matrix->pushed[index] != 0) {
+            return 0;
+        }
+    }
+
+    for (index = 0; index < matrix->row_num * matrix->col_num; index++) {
+        if (simpleButton_Private_ScannedKeyIsIdle(&(matrix->keys[index].Private)) == 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_MATRIX != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_LADDER != 0
+
+/**
+ * @brief           Initialize the analog pins, the ADC scan + DMA and the
+ *                  keys of a resistor ladder.
+ * 
+ * @param[in]       ladder - The resistor ladder created by `SIMPLEBTN__LADDER_CREATE`.
+ * 
+ * @note            The ADC converts all the pins again and again and the DMA
+ *                  writes the results into `ladder->samples` (circular). No
+ *                  interrupt is used, the CPU reads the buffer in
+ *                  `SimpleButton_Ladder_ScanAt()` only.
+ * 
+ * @return          None
+ */
+SIMPLEBTN_C_API void SimpleButton_Ladder_Init(const SimpleButton_Type_Ladder_t* const ladder)
+{
+    const uint16_t sample_num = (uint16_t)(SIMPLEBTN_LADDER_BATCH * ladder->channel_num);
+    uint16_t index;
+
+    for (index = 0; index < sample_num; index++) {
+        ladder->samples[index] = SIMPLEBTN_LADDER_RELEASED; /* no key until the first batch */
+    }
+    for (index = 0; index < ladder->key_num; index++) {
+        simpleButton_Private_InitStructPrivate(&(ladder->keys[index].Private));
+        simpleButton_Private_InitStructPublic(&(ladder->keys[index].Public));
+#if defined(SIMPLEBTN_DEBUG)
+        if (ladder->levels[index].channel >= ladder->channel_num) {
+            SIMPLEBTN_FUNC_PANIC("ladder key on an invalid pin", , );
+        }
+#endif /* defined(SIMPLEBTN_DEBUG) */
+    }
+    for (index = 0; index < ladder->channel_num; index++) {
+        ladder->selected[index] = SIMPLEBTN_LADDER_NONE;
+        SIMPLEBTN_FUNC_INIT_LADDER_CHANNEL(
+            ladder->channels[index].gpiox_base,
+            ladder->channels[index].gpio_pin_x,
+            ladder->channels[index].adc_channel,
+            (uint8_t)index
+        );
+    }
+
+    SIMPLEBTN_FUNC_INIT_LADDER_ADC(ladder->channel_num, ladder->samples, sample_num);
+}
+
+/* Whether the last batch found this key on its pin (never for a key on an invalid pin) */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_LadderIsPushed(const SimpleButton_Type_Ladder_t* const ladder, const uint8_t key)
+{
+    const uint8_t channel = ladder->levels[key].channel;
+
+    return (uint8_t)(channel < ladder->channel_num && ladder->selected[channel] == key);
+}
+
+/* The distance of two ADC values */
+SIMPLEBTN_FORCE_INLINE uint16_t simpleButton_Private_LadderDistance(const uint16_t a, const uint16_t b)
+{
+    return (uint16_t)((a > b) ? (a - b) : (b - a));
+}
+
+/**
+ * @brief           Read the last batch of a resistor ladder and find the key
+ *                  of each pin. Call it once per pass, before the handlers of
+ *                  its keys.
+ * 
+ * @param[in]       ladder - The resistor ladder.
+ * @param[in]       now - The tick snapshot of this pass (`SIMPLEBTN_FUNC_GET_TICK()`).
+ * 
+ * @note            Each pin is averaged over the `SIMPLEBTN_LADDER_BATCH`
+ *                  rounds of the buffer, and the nearest level (or
+ *                  `SIMPLEBTN_LADDER_RELEASED`) is its key. It only changes
+ *                  if the new level is closer than the current one by
+ *                  `SIMPLEBTN_LADDER_HYSTERESIS`, and a batch spreading more
+ *                  than `SIMPLEBTN_LADDER_SPREAD` (the voltage is moving
+ *                  between two levels) keeps the last key.
+ * 
+ * @return          The tick at which the scan needs to run again.
+ */
+SIMPLEBTN_C_API HOT_ uint32_t
+SimpleButton_Ladder_ScanAt(const SimpleButton_Type_Ladder_t* const ladder, const uint32_t now)
+{
+    uint32_t interval = SIMPLEBTN_TIME_LADDER_SCAN;
+    uint8_t busy = 0;
+    uint8_t channel, key, round;
+
+    for (channel = 0; channel < ladder->channel_num; channel++) {
+        const uint8_t current = ladder->selected[channel];
+        uint32_t sum = 0;
+        uint16_t low = 0xFFFFU, high = 0;
+
+        /* one pass over the batch, the DMA keeps writing behind it */
+        for (round = 0; round < SIMPLEBTN_LADDER_BATCH; round++) {
+            const uint16_t sample = ladder->samples[round * ladder->channel_num + channel];
+
+            sum += sample;
+            low = (sample < low) ? sample : low;
+            high = (sample > high) ? sample : high;
+        }
+
+        if ((uint16_t)(high - low) <= SIMPLEBTN_LADDER_SPREAD) {
+            const uint16_t average = (uint16_t)(sum / SIMPLEBTN_LADDER_BATCH);
+            uint16_t best_distance = simpleButton_Private_LadderDistance(average, SIMPLEBTN_LADDER_RELEASED);
+            uint16_t current_distance = best_distance;
+            uint8_t best = SIMPLEBTN_LADDER_NONE;
+
+            for (key = 0; key < ladder->key_num; key++) {
+                uint16_t distance;
+
+                if (ladder->levels[key].channel != channel) {
+                    continue;
+                }
+                distance = simpleButton_Private_LadderDistance(average, ladder->levels[key].level);
+                if (distance < best_distance) {
+                    best = key;
+                    best_distance = distance;
+                }
+                if (key == current) {
+                    current_distance = distance;
+                }
+            }
+
+            /* hysteresis: leave the current band only for a clearly closer one */
+            if (best != current && current_distance >= (uint32_t)best_distance + SIMPLEBTN_LADDER_HYSTERESIS) {
+                ladder->selected[channel] = best;
+            }
+        }
+
+        busy |= (uint8_t)(ladder->selected[channel] != SIMPLEBTN_LADDER_NONE);
+    }
+
+    for (key = 0; key < ladder->key_num; key++) {
+        simpleButton_Type_PrivateBtnStatus_t* const self_private = &(ladder->keys[key].Private);
+
+        busy |= (uint8_t)((simpleButton_Type_ButtonState_t)(self_private->state) != simpleButton_State_Wait_For_Interrupt);
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+        /* a batch is a sample of each key, at most one per SIMPLEBTN_TIME_INTEGRATE_INTERVAL */
+        (void)simpleButton_Private_Integrate(
+            self_private,
+            simpleButton_Private_LadderIsPushed(ladder, key),
+            now
+        );
+        if ((self_private->integrator & SIMPLEBTN_INTEGRATE_COUNT) != 0) {
+            busy = 1;
+            interval = SIMPLEBTN_TIME_INTEGRATE_INTERVAL; /* the key counts a change */
+        }
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
+    }
+
+    return now + ((busy != 0) ? interval : SIMPLEBTN_TIME_POLL_INTERVAL);
+}
+
+/**
+ * @brief           The handler shared by all the keys of a resistor ladder,
+ *                  run on the result of the last `SimpleButton_Ladder_ScanAt()`.
+ * 
+ * @param[in]       ladder - The resistor ladder.
+ * @param[in]       key - The id of the key (`prefix/namespace` + `__name` + `_ID`).
+ * @param[in]       now - The tick snapshot of this pass (`SIMPLEBTN_FUNC_GET_TICK()`).
+ * @param[in]       shortPushCallBack - callback function for short push.
+ * @param[in]       longPushCallBack - callback function for long push.
+ * @param[in]       repeatPushCallBack - callback function for repeat push.
+ * 
+ * @return          The tick at which the handler needs to run again,
+ *                  or `SIMPLEBTN__DEADLINE_NEVER` if it waits for a push.
+ */
+SIMPLEBTN_C_API HOT_ uint32_t
+SimpleButton_Ladder_HandlerAt(
+    const SimpleButton_Type_Ladder_t* const ladder,
+    const uint8_t key,
+    const uint32_t now,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+) {
+    SimpleButton_Type_LadderKey_t* const self = &(ladder->keys[key]);
+
+    return simpleButton_Private_ScannedKeyHandlerAt(
+        &(self->Private),
+        &(self->Public),
+        simpleButton_Private_LadderIsPushed(ladder, key),
+        now,
+        shortPushCallBack,
+        longPushCallBack,
+        repeatPushCallBack
+    );
+}
+
+/**
+ * @brief           Check whether all the keys of a resistor ladder are idle
+ *                  and released, e.g. before entering low-power mode.
+ * 
+ * @param[in]       ladder - The resistor ladder.
+ * 
+ * @return          1 if all are idle, otherwise 0.
+ */
+SIMPLEBTN_C_API uint8_t SimpleButton_Ladder_IsIdle(const SimpleButton_Type_Ladder_t* const ladder)
+{
+    uint8_t index;
+
+    for (index = 0; index < ladder->channel_num; index++) {
+        if (ladder->selected[index] != SIMPLEBTN_LADDER_NONE) {
+            return 0;
+        }
+    }
+
+    for (index = 0; index < ladder->key_num; index++) {
+        if (simpleButton_Private_ScannedKeyIsIdle(&(ladder->keys[index].Private)) == 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_LADDER != 0 */
+
+
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+
+/* The registry of buttons, walked by SimpleButton_ProcessAll() */
+static simpleButton_Type_RegistryEntry_t simpleButton_Registry[SIMPLEBTN_REGISTRY_CAPACITY];
+
+static uint8_t simpleButton_RegistryCount = 0;
+
+#if SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0
+
+/* Min-heap of the registry ids that have a deadline (the earliest on top) */
+static uint8_t simpleButton_Heap[SIMPLEBTN_REGISTRY_CAPACITY];
+
+static uint8_t simpleButton_HeapSize = 0;
+
+/* Position of each registry id in the heap, or SIMPLEBTN_REGISTRY_INVALID_ID */
+static uint8_t simpleButton_HeapPos[SIMPLEBTN_REGISTRY_CAPACITY];
+
+/* Deadline of each registry id in the heap */
+static uint32_t simpleButton_HeapDeadline[SIMPLEBTN_REGISTRY_CAPACITY];
+
+/* Deadline `a` is earlier than deadline `b` (wraparound safe) */
+#define SIMPLEBTN_HEAP_BEFORE(a, b)     ((int32_t)((uint32_t)(a) - (uint32_t)(b)) < 0)
+
+/* Put `id` at heap position `pos` */
+SIMPLEBTN_FORCE_INLINE void simpleButton_Private_HeapPlace(const uint8_t pos, const uint8_t id)
+{
+    simpleButton_Heap[pos] = id;
+    simpleButton_HeapPos[id] = pos;
+}
+
+/* Move the id at `pos` up or down until the heap order holds again */
+static void simpleButton_Private_HeapFix(uint8_t pos)
+{
+    const uint8_t id = simpleButton_Heap[pos];
+    const uint32_t deadline = simpleButton_HeapDeadline[id];
+    uint8_t parent, child;
+
+    while (pos > 0) {
+        parent = (uint8_t)((pos - 1) >> 1);
+        if (!SIMPLEBTN_HEAP_BEFORE(deadline, simpleButton_HeapDeadline[simpleButton_Heap[parent]])) {
+            break;
+        }
+        simpleButton_Private_HeapPlace(pos, simpleButton_Heap[parent]);
+        pos = parent;
+    }
+
+    while ((child = (uint8_t)(2 * pos + 1)) < simpleButton_HeapSize) {
+        if (
+            child + 1 < simpleButton_HeapSize
+            && SIMPLEBTN_HEAP_BEFORE(
+                simpleButton_HeapDeadline[simpleButton_Heap[child + 1]],
+                simpleButton_HeapDeadline[simpleButton_Heap[child]]
+            )
+        ) {
+            child ++;
+        }
+        if (!SIMPLEBTN_HEAP_BEFORE(simpleButton_HeapDeadline[simpleButton_Heap[child]], deadline)) {
+            break;
+        }
+        simpleButton_Private_HeapPlace(pos, simpleButton_Heap[child]);
+        pos = child;
+    }
+
+    simpleButton_Private_HeapPlace(pos, id);
+}
+
+/* Set (or remove, with SIMPLEBTN__DEADLINE_NEVER) the deadline of a registry id */
+static void simpleButton_Private_HeapSet(const uint8_t id, const uint32_t deadline)
+{
+    uint8_t pos = simpleButton_HeapPos[id];
+
+    if (deadline == SIMPLEBTN__DEADLINE_NEVER) {
+        if (pos == SIMPLEBTN_REGISTRY_INVALID_ID) {
+            return; /* not in the heap */
+        }
+        simpleButton_HeapPos[id] = SIMPLEBTN_REGISTRY_INVALID_ID;
+        simpleButton_HeapSize --;
+        if (pos != simpleButton_HeapSize) {
+            simpleButton_Private_HeapPlace(pos, simpleButton_Heap[simpleButton_HeapSize]);
+            simpleButton_Private_HeapFix(pos);
+        }
+        return;
+    }
+
+    if (pos == SIMPLEBTN_REGISTRY_INVALID_ID) {
+        pos = simpleButton_HeapSize ++;
+        simpleButton_Private_HeapPlace(pos, id);
+    }
+    simpleButton_HeapDeadline[id] = deadline;
+    simpleButton_Private_HeapFix(pos);
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0
+
+/* The GPIO ports used by registered buttons, each is read once per pass */
+static simpleButton_Type_GPIOBase_t simpleButton_RegistryPort[SIMPLEBTN_REGISTRY_PORT_CAPACITY];
+
+static uint8_t simpleButton_RegistryPortCount = 0;
+
+ #if SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0
+
+/* Vertical counters of each port in the port table */
+static simpleButton_Type_VerticalCounter_t simpleButton_RegistryPortVC[SIMPLEBTN_REGISTRY_PORT_CAPACITY];
+
+static uint32_t simpleButton_RegistryLastSample = 0;
+
+/* Debounce all the pins of one port at once. A pin toggles its stable
+   level after it differs from it in 4 consecutive samples. */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_VerticalDebounce(
+    simpleButton_Type_VerticalCounter_t* const vc,
+    const uint32_t sample
+) {
+    const uint32_t delta = sample ^ vc->stable;
+
+    /* 2-bit counter per pin, cleared where the sample equals the stable level */
+    vc->cnt1 = (vc->cnt1 ^ vc->cnt0) & delta;
+    vc->cnt0 = ~(vc->cnt0) & delta;
+
+    /* counter wrapped to 0 with delta still set -> toggle */
+    vc->stable ^= delta & ~(vc->cnt0 | vc->cnt1);
+
+    return vc->stable;
+}
+
+ #endif /* SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0 */
+
+/* Find (or add) the port in the port table */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_RegistryPortIndex(
+    const simpleButton_Type_GPIOBase_t gpiox_base
+) {
+    uint8_t index;
+
+    for (index = 0; index < simpleButton_RegistryPortCount; index++) {
+        if (simpleButton_RegistryPort[index] == gpiox_base) {
+            return index;
+        }
+    }
+
+    if (simpleButton_RegistryPortCount >= SIMPLEBTN_REGISTRY_PORT_CAPACITY) {
+        return SIMPLEBTN_REGISTRY_INVALID_ID;
+    }
+
+    simpleButton_RegistryPort[index] = gpiox_base;
+    simpleButton_RegistryPortCount = (uint8_t)(index + 1);
+
+    return index;
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0 */
+
+/**
+ * @brief           Add a button to the registry.
+ *
+ * @param[in]       self_private - pointer to self.Private struct.
+ * @param[in]       self_public - pointer to self.Public struct.
+ * @param[in]       gpiox_base - Address of GPIO port connected to the button.
+ * @param[in]       gpio_pin_x - GPIO pin number connected to the button.
+ * @param[in]       normal_pin_val - Normal(didn't push) pin value of button pin. (can be 1 or 0)
+ * @param[in]       isDynamic - The button needs polling (dynamic-button) or not (EXTI button).
+ * @param[in]       shortPushCallBack - callback function for short push.
+ * @param[in]       longPushCallBack - callback function for long push.
+ * @param[in]       repeatPushCallBack - callback function for repeat push.
+ *
+ * @return          The id (registry index) of the button,
+ *                  or `SIMPLEBTN_REGISTRY_INVALID_ID` if the registry is full.
+ */
+SIMPLEBTN_C_API uint8_t simpleButton_Private_RegistryAdd(
+    simpleButton_Type_PrivateBtnStatus_t* self_private,
+    simpleButton_Type_PublicBtnStatus_t* self_public,
+    simpleButton_Type_GPIOBase_t gpiox_base,
+    simpleButton_Type_GPIOPin_t gpio_pin_x,
+    simpleButton_Type_GPIOPinVal_t normal_pin_val,
+    uint8_t isDynamic,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+) {
+    simpleButton_Type_RegistryEntry_t* entry;
+    uint8_t id;
+#if SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0
+    uint8_t portIndex;
+#endif /* SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0 */
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    if (simpleButton_RegistryCount >= SIMPLEBTN_REGISTRY_CAPACITY) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+#if defined(SIMPLEBTN_DEBUG)
+        SIMPLEBTN_FUNC_PANIC("button registry is full", , );
+#endif /* defined(SIMPLEBTN_DEBUG) */
+        return SIMPLEBTN_REGISTRY_INVALID_ID;
+    }
+
+#if SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0
+    portIndex = simpleButton_Private_RegistryPortIndex(gpiox_base);
+    if (portIndex == SIMPLEBTN_REGISTRY_INVALID_ID) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+ #if defined(SIMPLEBTN_DEBUG)
+        SIMPLEBTN_FUNC_PANIC("registry port table is full", , );
+ #endif /* defined(SIMPLEBTN_DEBUG) */
+        return SIMPLEBTN_REGISTRY_INVALID_ID;
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0 */
+
+    id = simpleButton_RegistryCount;
+    entry = &(simpleButton_Registry[id]);
+
+    entry->self_private = self_private;
+    entry->self_public = self_public;
+    entry->gpiox_base = gpiox_base;
+    entry->gpio_pin_x = gpio_pin_x;
+    entry->normal_pin_val = normal_pin_val;
+    entry->isDynamic = isDynamic;
+#if SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0
+    entry->portIndex = portIndex;
+#endif /* SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0
+    /* start from the released level */
+    simpleButton_RegistryPortVC[portIndex].cnt0 &= ~(uint32_t)gpio_pin_x;
+    simpleButton_RegistryPortVC[portIndex].cnt1 &= ~(uint32_t)gpio_pin_x;
+    if (normal_pin_val != 0) {
+        simpleButton_RegistryPortVC[portIndex].stable |= (uint32_t)gpio_pin_x;
+    } else {
+        simpleButton_RegistryPortVC[portIndex].stable &= ~(uint32_t)gpio_pin_x;
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0 */
+    entry->shortPushCallBack = shortPushCallBack;
+    entry->longPushCallBack = longPushCallBack;
+    entry->repeatPushCallBack = repeatPushCallBack;
+
+    simpleButton_RegistryCount = (uint8_t)(id + 1);
+
+#if SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0
+    /* run the button in the next pass, it drops out of the heap when idle */
+    self_private->heap_slot = (uint8_t)(id + 1);
+    simpleButton_HeapPos[id] = SIMPLEBTN_REGISTRY_INVALID_ID;
+    simpleButton_Private_HeapSet(id, SIMPLEBTN_FUNC_GET_TICK());
+#endif /* SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0 */
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+
+    return id;
+}
+
+/**
+ * @brief           Add a dynamic-button to the registry, so that it is
+ *                  handled by `SimpleButton_ProcessAll()`.
+ *
+ * @param[inout]    self - The pointer of dynamic-button object (initialized).
+ * @param[in]       shortPushCallBack - callback function for short push.
+ * @param[in]       longPushCallBack - callback function for long push.
+ * @param[in]       repeatPushCallBack - callback function for repeat push.
+ *
+ * @return          The id (registry index) of the button,
+ *                  or `SIMPLEBTN_REGISTRY_INVALID_ID` if the registry is full.
+ */
+SIMPLEBTN_C_API uint8_t
+SimpleButton_DynamicButton_Register(
+    SimpleButton_Type_DynamicBtn_t* const self,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+) {
+    return simpleButton_Private_RegistryAdd(
+        &(self->Private),
+        &(self->Public),
         self->GPIO_Base,
         self->GPIO_Pin,
         self->normalPinVal,
+        1,
         shortPushCallBack,
         longPushCallBack,
         repeatPushCallBack
     );
 }
+
+/* Run the State-Machine of one registry entry, return its next deadline.
+   `portValue` is the port snapshot of this pass (port-sampling mode). */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_RegistryRun(
+    simpleButton_Type_RegistryEntry_t* const entry,
+    const uint32_t* const portValue,
+    const uint32_t now
+) {
+    uint32_t deadline;
+    uint8_t is_pushed;
+
+#if SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0
+    const uint8_t state_before = entry->self_private->state;
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0
+    is_pushed = (uint8_t)(
+        ((portValue[entry->portIndex] & (uint32_t)entry->gpio_pin_x) != 0)
+        != (entry->normal_pin_val != 0)
+    );
+#else
+    (void)portValue;
+    is_pushed = simpleButton_Private_ReadIsPushed(
+        entry->self_private,
+        (entry->isDynamic != 0) ? SIMPLEBTN_STATE_MASK_POLL_PIN : SIMPLEBTN_STATE_MASK_READ_PIN,
+        entry->gpiox_base,
+        entry->gpio_pin_x,
+        entry->normal_pin_val
+    );
+#endif /* SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0 */
+
+    if (entry->isDynamic != 0) {
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+        is_pushed = simpleButton_Private_Integrate(entry->self_private, is_pushed, now);
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
+        simpleButton_Private_DynamicBtn_CheckState(entry->self_private, is_pushed, now);
+    }
+
+    deadline = simpleButton_Private_StateMachine(
+        entry->self_private,
+        entry->self_public,
+        is_pushed,
+        (SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0)
+            || (SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 && entry->isDynamic != 0),
+#if SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0
+        (uint8_t)(entry - &(simpleButton_Registry[0])),
+#else
+        SIMPLEBTN_BUTTON_ID_NONE,
+#endif /* SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0 */
+        now,
+        entry->shortPushCallBack,
+        entry->longPushCallBack,
+        entry->repeatPushCallBack
+    );
+
+    if (entry->isDynamic != 0) {
+        deadline = simpleButton_Private_PolledDeadline(entry->self_private, deadline, now);
+    }
+#if SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0
+    else {
+        deadline = simpleButton_Private_ExtiRearm(
+            entry->self_private, state_before, entry->gpiox_base,
+            entry->gpio_pin_x, entry->normal_pin_val, deadline, now
+        );
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0 */
+
+    return deadline;
+}
+
+/**
+ * @brief           Handle all the registered buttons (static and dynamic)
+ *                  in one pass. Call it in while loop instead of calling
+ *                  the handler of each button.
+ *
+ * @note            In port-sampling mode, every GPIO port used by the registry
+ *                  is read once at the beginning of the pass, so all buttons
+ *                  of the pass are evaluated from the same snapshot.
+ *                  With vertical debounce, the ports are sampled every
+ *                  `SIMPLEBTN_TIME_VERTICAL_SAMPLE` ms and the debounced
+ *                  snapshot is used instead.
+ *                  In deadline-heap mode, only the buttons whose deadline has
+ *                  expired (or that were woken by their EXTI) are run, the
+ *                  cost of a pass follows the expiring timers, not the count
+ *                  of buttons. The returned deadline can program one hardware
+ *                  compare channel.
+ *
+ * @param[in]       now - The tick snapshot of this pass (`SIMPLEBTN_FUNC_GET_TICK()`),
+ *                  shared by all the registered buttons.
+ *
+ * @return          The earliest tick at which one of the buttons needs to run
+ *                  again, or `SIMPLEBTN__DEADLINE_NEVER` if all of them wait
+ *                  for interrupts.
+ */
+SIMPLEBTN_C_API HOT_ uint32_t SimpleButton_ProcessAllAt(const uint32_t now)
+{
+    simpleButton_Type_RegistryEntry_t* entry = &(simpleButton_Registry[0]);
+    simpleButton_Type_RegistryEntry_t* const end = entry + simpleButton_RegistryCount;
+    uint32_t nextDeadline = SIMPLEBTN__DEADLINE_NEVER;
+
+#if SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0
+    uint8_t expired[SIMPLEBTN_REGISTRY_CAPACITY];
+    uint8_t expiredCount = 0;
+    uint8_t index, word;
+    uint32_t woken, deadline;
+#endif /* SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING == 0
+    const uint32_t* const portValue = 0; /* the pins are read one by one */
+#endif /* SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING == 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0
+    uint32_t portValue[SIMPLEBTN_REGISTRY_PORT_CAPACITY];
+    uint8_t portIndex;
+
+#if SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0
+    const uint8_t need_sample = (uint8_t)(
+        now - simpleButton_RegistryLastSample >= SIMPLEBTN_TIME_VERTICAL_SAMPLE
+    );
+
+    if (need_sample) {
+        simpleButton_RegistryLastSample = now;
+    }
+
+    for (portIndex = 0; portIndex < simpleButton_RegistryPortCount; portIndex++) {
+        if (need_sample) {
+            portValue[portIndex] = simpleButton_Private_VerticalDebounce(
+                &(simpleButton_RegistryPortVC[portIndex]),
+                (uint32_t)SIMPLEBTN_FUNC_READ_PORT(simpleButton_RegistryPort[portIndex])
+            );
+        } else {
+            portValue[portIndex] = simpleButton_RegistryPortVC[portIndex].stable;
+        }
+    }
+ #else
+    for (portIndex = 0; portIndex < simpleButton_RegistryPortCount; portIndex++) {
+        portValue[portIndex] = (uint32_t)SIMPLEBTN_FUNC_READ_PORT(simpleButton_RegistryPort[portIndex]);
+    }
+ #endif /* SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0 */
+#endif /* SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP == 0
+
+    for (; entry != end; entry++) {
+        nextDeadline = SimpleButton_EarlierDeadline(
+            nextDeadline,
+            simpleButton_Private_RegistryRun(entry, portValue, now)
+        );
+    }
+
+#else
+
+    (void)end;
+
+    /* buttons woken by their EXTI run in this pass */
+    for (word = 0; word < (SIMPLEBTN_REGISTRY_CAPACITY + 31) / 32; word++) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+        woken = simpleButton_HeapWoken[word];
+        simpleButton_HeapWoken[word] = 0;
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+
+        while (woken != 0) {
+            simpleButton_Private_HeapSet((uint8_t)(word * 32 + SIMPLEBTN_CTZ(woken)), now);
+            woken &= woken - 1; /* clear the lowest set bit */
+        }
+    }
+
+    /* take the expired ones out first, a callback state is due again at once */
+    while (
+        simpleButton_HeapSize != 0
+        && !SIMPLEBTN_HEAP_BEFORE(now, simpleButton_HeapDeadline[simpleButton_Heap[0]])
+    ) {
+        expired[expiredCount++] = simpleButton_Heap[0];
+        simpleButton_Private_HeapSet(simpleButton_Heap[0], SIMPLEBTN__DEADLINE_NEVER);
+    }
+
+    /* only the expired buttons are touched */
+    for (index = 0; index < expiredCount; index++) {
+        deadline = simpleButton_Private_RegistryRun(&(entry[expired[index]]), portValue, now);
+#if SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0
+        /* a busy button follows the debounced snapshot at each sample */
+        if (deadline != SIMPLEBTN__DEADLINE_NEVER) {
+            deadline = SimpleButton_EarlierDeadline(
+                deadline,
+                simpleButton_RegistryLastSample + SIMPLEBTN_TIME_VERTICAL_SAMPLE
+            );
+        }
+#endif /* SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0 */
+        simpleButton_Private_HeapSet(expired[index], deadline);
+    }
+
+    if (simpleButton_HeapSize != 0) {
+        nextDeadline = simpleButton_HeapDeadline[simpleButton_Heap[0]];
+    }
+
+    /* woken during this pass, run again at once */
+    for (word = 0; word < (SIMPLEBTN_REGISTRY_CAPACITY + 31) / 32; word++) {
+        if (simpleButton_HeapWoken[word] != 0) {
+            nextDeadline = now;
+        }
+    }
+
+#endif /* SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP == 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0
+    /* the debounce counters need the next sample while a button is busy */
+    if (nextDeadline != SIMPLEBTN__DEADLINE_NEVER) {
+        nextDeadline = SimpleButton_EarlierDeadline(
+            nextDeadline,
+            simpleButton_RegistryLastSample + SIMPLEBTN_TIME_VERTICAL_SAMPLE
+        );
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0 */
+
+    return nextDeadline;
+}
+
+/**
+ * @brief           Handle all the registered buttons, reading the tick once.
+ * @return          Same as `SimpleButton_ProcessAllAt()`.
+ */
+SIMPLEBTN_C_API HOT_ uint32_t SimpleButton_ProcessAll(void)
+{
+    return SimpleButton_ProcessAllAt(SIMPLEBTN_FUNC_GET_TICK());
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0
+
+/**
+ * @brief           Take the oldest event out of the event queue.
+ *                  Only one consumer (thread) may call it.
+ *
+ * @param[out]      event - The event record to be filled.
+ *
+ * @return          1 if an event is taken, 0 if the queue is empty.
+ */
+SIMPLEBTN_C_API uint8_t SimpleButton_EventQueue_Pop(SimpleButton_Type_Event_t* const event)
+{
+    const uint8_t tail = simpleButton_EventQueue.tail;
+
+    if (tail == simpleButton_EventQueue.head) {
+        return 0; /* queue is empty */
+    }
+
+    SIMPLEBTN_MEMORY_BARRIER(); /* read the record after seeing the new head */
+    *event = simpleButton_EventQueue.buffer[tail];
+    SIMPLEBTN_MEMORY_BARRIER(); /* finish reading before the slot is released */
+
+    simpleButton_EventQueue.tail = (uint8_t)((tail + 1) & (SIMPLEBTN_EVENT_QUEUE_SIZE - 1));
+
+    return 1;
+}
+
+/**
+ * @brief           Get the number of events dropped because the queue was full.
+ *
+ * @return          The number of dropped events since power on.
+ */
+SIMPLEBTN_C_API uint32_t SimpleButton_EventQueue_GetDropped(void)
+{
+    return simpleButton_EventQueue.dropped;
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0 */
@@ -21,7 +21,12 @@
 #define     SIMPLEBUTTON_H__    1019L
 
 /* Incldue the config file of Simple_Button and check the version */
-#include    "simple_button_config.h"
+#if defined(SIMPLEBTN_CONFIG_FILE)
+ /* e.g. -DSIMPLEBTN_CONFIG_FILE='"platform/linux/simple_button_config.h"' */
+ #include   SIMPLEBTN_CONFIG_FILE
+#else
+ #include   "simple_button_config.h"
+#endif /* defined(SIMPLEBTN_CONFIG_FILE) */
 #if ( SIMPLEBUTTON_CONFIG_H__ != SIMPLEBUTTON_H__ )
  #warning [Simple-Button] : the version of "simple_button_config.h"\
  is different from it of "Simple_Button.h".
@@ -51,6 +56,124 @@
  #define SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M()
 #endif /* SIMPLEBTN_MODE_ENABLE_MULTI_THREADS == 1 */
 
+/* Port-sampling works on the registry */
+#if SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0
+ #if SIMPLEBTN_MODE_ENABLE_REGISTRY == 0
+  #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING needs SIMPLEBTN_MODE_ENABLE_REGISTRY.
+ #endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY == 0 */
+ #if !defined(SIMPLEBTN_FUNC_READ_PORT)
+  #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING needs SIMPLEBTN_FUNC_READ_PORT().
+ #endif /* !defined(SIMPLEBTN_FUNC_READ_PORT) */
+#endif /* SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0 */
+
+/* Vertical debounce works on the port snapshots */
+#if SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0 && SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING == 0
+ #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE needs SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING.
+#endif /* SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0 && ... */
+
+/* Event-queue reports the registry index as button id */
+#if SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0
+ #if SIMPLEBTN_MODE_ENABLE_REGISTRY == 0
+  #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE needs SIMPLEBTN_MODE_ENABLE_REGISTRY.
+ #endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY == 0 */
+ #if (SIMPLEBTN_EVENT_QUEUE_SIZE < 2) || (SIMPLEBTN_EVENT_QUEUE_SIZE > 128) \
+    || ((SIMPLEBTN_EVENT_QUEUE_SIZE & (SIMPLEBTN_EVENT_QUEUE_SIZE - 1)) != 0)
+  #error [Simple-Button] : SIMPLEBTN_EVENT_QUEUE_SIZE must be a power of 2 (2 ~ 128).
+ #endif /* SIMPLEBTN_EVENT_QUEUE_SIZE */
+#endif /* SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0 */
+
+/* EXTI dispatcher reads and clears the pending flags by itself */
+#if SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0
+ #if !defined(SIMPLEBTN_FUNC_EXTI_GET_PENDING) || !defined(SIMPLEBTN_FUNC_EXTI_CLEAR_PENDING)
+  #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH needs SIMPLEBTN_FUNC_EXTI_GET_PENDING() and SIMPLEBTN_FUNC_EXTI_CLEAR_PENDING().
+ #endif /* !defined(SIMPLEBTN_FUNC_EXTI_GET_PENDING) || ... */
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0 */
+
+/* Deadline heap schedules the registry buttons */
+#if SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0 && SIMPLEBTN_MODE_ENABLE_REGISTRY == 0
+ #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP needs SIMPLEBTN_MODE_ENABLE_REGISTRY.
+#endif /* SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0 && ... */
+
+/* EXTI masking needs to mask and re-arm the line of each button */
+#if SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0
+ #if !defined(SIMPLEBTN_FUNC_EXTI_MASK) || !defined(SIMPLEBTN_FUNC_EXTI_UNMASK)
+  #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_EXTI_MASKING needs SIMPLEBTN_FUNC_EXTI_MASK(EXTI_Lines) and SIMPLEBTN_FUNC_EXTI_UNMASK(EXTI_Lines).
+ #endif /* !defined(SIMPLEBTN_FUNC_EXTI_MASK) || ... */
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0 */
+
+/* Profiling reads a cycle counter, one histogram bin per power of 2 */
+#if SIMPLEBTN_MODE_ENABLE_PROFILING != 0
+ #if !defined(SIMPLEBTN_FUNC_GET_CYCLE)
+  #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_PROFILING needs SIMPLEBTN_FUNC_GET_CYCLE().
+ #endif /* !defined(SIMPLEBTN_FUNC_GET_CYCLE) */
+ #if !defined(SIMPLEBTN_PROFILE_HIST_BINS) || (SIMPLEBTN_PROFILE_HIST_BINS < 1) \
+    || (SIMPLEBTN_PROFILE_HIST_BINS > 32)
+  #error [Simple-Button] : SIMPLEBTN_PROFILE_HIST_BINS must be 1 ~ 32.
+ #endif /* SIMPLEBTN_PROFILE_HIST_BINS */
+#endif /* SIMPLEBTN_MODE_ENABLE_PROFILING != 0 */
+
+/* Trace ring buffer is indexed by a mask */
+#if SIMPLEBTN_MODE_ENABLE_TRACE != 0
+ #if !defined(SIMPLEBTN_TRACE_SIZE) || (SIMPLEBTN_TRACE_SIZE < 2) || (SIMPLEBTN_TRACE_SIZE > 32768) \
+    || ((SIMPLEBTN_TRACE_SIZE & (SIMPLEBTN_TRACE_SIZE - 1)) != 0)
+  #error [Simple-Button] : SIMPLEBTN_TRACE_SIZE must be a power of 2 (2 ~ 32768).
+ #endif /* SIMPLEBTN_TRACE_SIZE */
+#endif /* SIMPLEBTN_MODE_ENABLE_TRACE != 0 */
+
+/* Deep sleep stops the tick, it must be advanced after waking up */
+#if SIMPLEBTN_MODE_ENABLE_DEEP_SLEEP != 0
+ #if !defined(SIMPLEBTN_FUNC_START_DEEP_SLEEP) || !defined(SIMPLEBTN_FUNC_ADVANCE_TICK)
+  #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_DEEP_SLEEP needs SIMPLEBTN_FUNC_START_DEEP_SLEEP() and SIMPLEBTN_FUNC_ADVANCE_TICK(Ms).
+ #endif /* !defined(SIMPLEBTN_FUNC_START_DEEP_SLEEP) || ... */
+#endif /* SIMPLEBTN_MODE_ENABLE_DEEP_SLEEP != 0 */
+
+/* Adaptive debounce keeps the window of a button in 8 bits */
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+ #if !defined(SIMPLEBTN_DEBOUNCE_MIN) || !defined(SIMPLEBTN_DEBOUNCE_MAX) || !defined(SIMPLEBTN_DEBOUNCE_MARGIN) \
+    || (SIMPLEBTN_DEBOUNCE_MIN < 1) || (SIMPLEBTN_DEBOUNCE_MIN > SIMPLEBTN_DEBOUNCE_MAX) || (SIMPLEBTN_DEBOUNCE_MAX > 255)
+  #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE needs 1 <= SIMPLEBTN_DEBOUNCE_MIN <= SIMPLEBTN_DEBOUNCE_MAX <= 255 and SIMPLEBTN_DEBOUNCE_MARGIN.
+ #endif /* SIMPLEBTN_DEBOUNCE_xxx */
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
+/* Integrating debounce counts the disagreeing samples in 7 bits */
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+ #if !defined(SIMPLEBTN_INTEGRATE_SAMPLES) || !defined(SIMPLEBTN_TIME_INTEGRATE_INTERVAL) \
+    || (SIMPLEBTN_INTEGRATE_SAMPLES < 1) || (SIMPLEBTN_INTEGRATE_SAMPLES > 127)
+  #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE needs 1 <= SIMPLEBTN_INTEGRATE_SAMPLES <= 127 and SIMPLEBTN_TIME_INTEGRATE_INTERVAL.
+ #endif /* SIMPLEBTN_INTEGRATE_SAMPLES */
+ #define SIMPLEBTN_INTEGRATE_LEVEL          0x80U
+ #define SIMPLEBTN_INTEGRATE_COUNT          0x7FU
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
+
+/* Resistor ladder averages one batch per channel in 32 bits, key ids are 8-bit */
+#if SIMPLEBTN_MODE_ENABLE_LADDER != 0
+ #if !defined(SIMPLEBTN_LADDER_BATCH) || (SIMPLEBTN_LADDER_BATCH < 1) || (SIMPLEBTN_LADDER_BATCH > 64)
+  #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_LADDER needs 1 <= SIMPLEBTN_LADDER_BATCH <= 64.
+ #endif /* SIMPLEBTN_LADDER_BATCH */
+ #if !defined(SIMPLEBTN_LADDER_HYSTERESIS) || !defined(SIMPLEBTN_LADDER_SPREAD) \
+    || !defined(SIMPLEBTN_LADDER_RELEASED) || !defined(SIMPLEBTN_TIME_LADDER_SCAN)
+  #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_LADDER needs SIMPLEBTN_LADDER_HYSTERESIS / _SPREAD / _RELEASED and SIMPLEBTN_TIME_LADDER_SCAN.
+ #endif /* SIMPLEBTN_LADDER_xxx */
+ #define SIMPLEBTN_LADDER_NONE              0xFFU
+#endif /* SIMPLEBTN_MODE_ENABLE_LADDER != 0 */
+
+/* Compact state keeps 16-bit time stamps, plus a 4-bit epoch for the push time */
+#if SIMPLEBTN_MODE_ENABLE_COMPACT_STATE != 0
+ #define SIMPLEBTN_COMPACT_EPOCH_TICKS      0x8000UL
+ #define SIMPLEBTN_COMPACT_EPOCH_MAX        15
+ #define SIMPLEBTN_COMPACT_PUSH_TIME_MAX    \
+    (SIMPLEBTN_COMPACT_EPOCH_TICKS * (SIMPLEBTN_COMPACT_EPOCH_MAX + 1) - 1)
+ #if (SIMPLEBTN_TIME_PUSH_DELAY > 0x7FFF) || (SIMPLEBTN_TIME_RELEASE_DELAY > 0x7FFF) \
+    || (SIMPLEBTN_TIME_REPEAT_WINDOW > 0x7FFF) || (SIMPLEBTN_TIME_COOL_DOWN > 0x7FFF) \
+    || (SIMPLEBTN_TIME_HOLD_INTERVAL > 0x7FFF)
+  #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_COMPACT_STATE needs delay/window/interval times <= 32767 ms.
+ #endif /* SIMPLEBTN_TIME_xxx > 0x7FFF */
+ #if (SIMPLEBTN_TIME__TIMEOUT_NORMAL > SIMPLEBTN_COMPACT_PUSH_TIME_MAX) \
+    || (SIMPLEBTN_TIME__TIMEOUT_COMBINATION > SIMPLEBTN_COMPACT_PUSH_TIME_MAX)
+  #error [Simple-Button] : SIMPLEBTN_MODE_ENABLE_COMPACT_STATE needs timeouts <= 524287 ms.
+ #endif /* SIMPLEBTN_TIME__TIMEOUT_xxx > SIMPLEBTN_COMPACT_PUSH_TIME_MAX */
+#endif /* SIMPLEBTN_MODE_ENABLE_COMPACT_STATE != 0 */
+
 /* Macro for C API */
 #ifdef __cplusplus
  #define SIMPLEBTN_C_API extern "C"
@@ -69,6 +192,15 @@
  #endif
 #endif /* !defined(SIMPLEBTN_FORCE_INLINE) */
 
+/* Macro for memory barrier (orders the event-queue record and its index) */
+#if !defined(SIMPLEBTN_MEMORY_BARRIER)
+ #if defined(__GNUC__) || defined(__clang__)
+  #define SIMPLEBTN_MEMORY_BARRIER() __sync_synchronize()
+ #else
+  #define SIMPLEBTN_MEMORY_BARRIER() do {} while (0)
+ #endif
+#endif /* !defined(SIMPLEBTN_MEMORY_BARRIER) */
+
 /* Macro to connect 2 macro */
 #define SIMPLEBTN_CONNECT2(a, b) SIMPLEBTN_CONNECT2_1(a, b)
 #define SIMPLEBTN_CONNECT2_1(a, b) SIMPLEBTN_CONNECT2_2(a, b)
@@ -123,7 +255,12 @@ typedef void (* simpleButton_Type_ShortPushCallBack_t)(void);
  typedef void (* simpleButton_Type_CombinationPushCallBack_t)(void);
 #endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
 
-typedef void (* simpleButton_Type_AsynchronousHandler_t)(
+/* Press / Release callback function pointer Type */
+#if SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0
+ typedef void (* simpleButton_Type_PressCallBack_t)(void);
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0 */
+
+typedef uint32_t (* simpleButton_Type_AsynchronousHandler_t)(
             simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
             simpleButton_Type_LongPushCallBack_t longPushCallBack,
             simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
@@ -171,20 +308,82 @@ typedef enum simpleButton_Type_ButtonState_t {
 
 #endif /* SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0 */
 
+    simpleButton_State_Count, /* the number of states, not a state */
+
 } simpleButton_Type_ButtonState_t;
 
 /* struct for button private status. */
-typedef struct simpleButton_Type_PrivateBtnStatus_t {
+#if SIMPLEBTN_MODE_ENABLE_COMPACT_STATE == 0
+
+ /* Type of the time stamps kept by a button */
+ typedef uint32_t simpleButton_Type_TimeStamp_t;
+
+ typedef struct simpleButton_Type_PrivateBtnStatus_t {
 
-    uint32_t                        timeStamp_loop; /* used in while loop */
+    simpleButton_Type_TimeStamp_t   timeStamp_loop; /* used in while loop */
 
-    volatile uint32_t               timeStamp_interrupt; /* used in interrupt */
+    volatile simpleButton_Type_TimeStamp_t timeStamp_interrupt; /* used in interrupt */
 
     volatile SIMPLEBTN_BITFIELD (simpleButton_Type_ButtonState_t) state : 8;
 
     uint8_t                         push_time;
 
-} simpleButton_Type_PrivateBtnStatus_t;
+#if SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0
+    uint8_t                         heap_slot; /* registry id + 1, 0 if not registered */
+#endif /* SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+    uint8_t                         debounce; /* push / release delay of this button (ticks) */
+
+    uint8_t                         bounce; /* latest bounce in the running debounce (ticks + 1), 0 if none */
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+    uint8_t                         integrator; /* dynamic-button: debounced level (bit 7), disagreeing samples in a row (bit 0-6) */
+
+    simpleButton_Type_TimeStamp_t   timeStamp_sample; /* dynamic-button: tick of the last integrated sample */
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
+
+ } simpleButton_Type_PrivateBtnStatus_t;
+
+#else
+
+ /* Type of the time stamps kept by a button (low 16 bits of the tick) */
+ typedef uint16_t simpleButton_Type_TimeStamp_t;
+
+ /* 6 bytes: the stamps are compared by 16-bit unsigned subtraction,
+    `epoch` extends the push time by SIMPLEBTN_COMPACT_EPOCH_TICKS per step. */
+ typedef struct simpleButton_Type_PrivateBtnStatus_t {
+
+    simpleButton_Type_TimeStamp_t   timeStamp_loop; /* used in while loop */
+
+    volatile simpleButton_Type_TimeStamp_t timeStamp_interrupt; /* used in interrupt */
+
+    volatile uint8_t                state : 4; /* simpleButton_Type_ButtonState_t */
+
+    volatile uint8_t                epoch : 4; /* elapsed epochs of timeStamp_interrupt */
+
+    uint8_t                         push_time;
+
+#if SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0
+    uint8_t                         heap_slot; /* registry id + 1, 0 if not registered */
+#endif /* SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+    uint8_t                         debounce; /* push / release delay of this button (ticks) */
+
+    uint8_t                         bounce; /* latest bounce in the running debounce (ticks + 1), 0 if none */
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+    uint8_t                         integrator; /* dynamic-button: debounced level (bit 7), disagreeing samples in a row (bit 0-6) */
+
+    simpleButton_Type_TimeStamp_t   timeStamp_sample; /* dynamic-button: tick of the last integrated sample */
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
+
+ } simpleButton_Type_PrivateBtnStatus_t;
+
+#endif /* SIMPLEBTN_MODE_ENABLE_COMPACT_STATE == 0 */
 
 /* struct for combination status and config. */
 #if SIMPLEBTN_MODE_ENABLE_COMBINATION != 0
@@ -200,6 +399,52 @@ typedef struct simpleButton_Type_PrivateBtnStatus_t {
 
 #endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
 
+#if SIMPLEBTN_MODE_ENABLE_PROFILING != 0
+
+/* struct for the cycle statistics of one profiled site. */
+typedef struct SimpleButton_Type_ProfStat_t {
+
+    uint32_t                        count; /* number of samples */
+
+    uint32_t                        min; /* cycles, valid if count != 0 */
+
+    uint32_t                        max; /* cycles */
+
+    uint64_t                        sum; /* cycles, mean = sum / count */
+
+    uint16_t                        hist[SIMPLEBTN_PROFILE_HIST_BINS]; /* bin k: 2^k ~ 2^(k+1)-1 cycles (saturated) */
+
+} SimpleButton_Type_ProfStat_t;
+
+/* enum for the profiled sites. */
+typedef enum SimpleButton_Type_ProfSite_t {
+    SimpleButton_Prof_Interrupt = 0,
+
+    SimpleButton_Prof_ShortPushCallBack,
+
+    SimpleButton_Prof_LongPushCallBack,
+
+    SimpleButton_Prof_RepeatPushCallBack,
+
+    SimpleButton_Prof_CombinationCallBack,
+
+    SimpleButton_Prof_PressCallBack,
+
+    SimpleButton_Prof_ReleaseCallBack,
+
+    SimpleButton_Prof_State, /* + simpleButton_State_xxx: the handler of that state */
+
+} SimpleButton_Type_ProfSite_t;
+
+/* The number of profiled sites */
+#define SIMPLEBTN__PROF_SITE_NUM        ((uint8_t)SimpleButton_Prof_State + (uint8_t)simpleButton_State_Count)
+
+/* The mean cycles of a SimpleButton_Type_ProfStat_t */
+#define SIMPLEBTN__PROF_MEAN(Stat)      \
+    ((uint32_t)(((Stat).count != 0) ? ((Stat).sum / (Stat).count) : 0))
+
+#endif /* SIMPLEBTN_MODE_ENABLE_PROFILING != 0 */
+
 /* struct for public status and config. */
 typedef struct simpleButton_Type_PublicBtnStatus_t {
 
@@ -207,12 +452,21 @@ typedef struct simpleButton_Type_PublicBtnStatus_t {
     simpleButton_Type_CmbBtnConfig_t combinationConfig;
 #endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
 
+#if SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0
+    volatile simpleButton_Type_PressCallBack_t pressCallBack; /* called when the push is debounced */
+    volatile simpleButton_Type_PressCallBack_t releaseCallBack; /* called when the release is debounced */
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0 */
+
 #if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
 
- #if SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
+ #if SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0 && SIMPLEBTN_MODE_ENABLE_COMPACT_STATE == 0
 
     uint32_t                        holdPushMinTime;
 
+ #elif SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
+
+    uint16_t                        holdPushMinTime;
+
  #endif /* SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0 */
 
     uint16_t                        longPushMinTime;
@@ -220,6 +474,10 @@ typedef struct simpleButton_Type_PublicBtnStatus_t {
     uint16_t                        repeatWindowTime;
 
 #endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_PROFILING != 0
+    SimpleButton_Type_ProfStat_t    profile; /* cycles of the state handlers of this button */
+#endif /* SIMPLEBTN_MODE_ENABLE_PROFILING != 0 */
 } simpleButton_Type_PublicBtnStatus_t;
 
 /* struct for public method. */
@@ -272,6 +530,350 @@ typedef struct SimpleButton_Type_DynamicBtn_t {
     
 } SimpleButton_Type_DynamicBtn_t;
 
+#if SIMPLEBTN_MODE_ENABLE_BUTTON_TABLE != 0
+
+/* struct for the constant config of one button in a button table (in flash). */
+typedef struct simpleButton_Type_TableConfig_t {
+
+    simpleButton_Type_GPIOBase_t    gpiox_base;
+
+    simpleButton_Type_GPIOPin_t     gpio_pin_x;
+
+    simpleButton_Type_GPIOPinVal_t  normal_pin_val;
+
+    uint8_t                         exti_trigger; /* simpleButton_Type_EXTITrigger_t */
+
+} simpleButton_Type_TableConfig_t;
+
+/* struct for the status of one button in a button table (in RAM, no methods).
+   `Private` is the first member, because `Public` may be empty. */
+typedef struct SimpleButton_Type_TableBtn_t {
+
+    simpleButton_Type_PrivateBtnStatus_t Private;
+
+    simpleButton_Type_PublicBtnStatus_t Public;
+
+} SimpleButton_Type_TableBtn_t;
+
+/**
+ * @typedef     SimpleButton_Type_BtnTable_t
+ * 
+ * @brief       A table of buttons created by `SIMPLEBTN__TABLE_CREATE`.
+ *              All the buttons share `SimpleButton_Table_xxx` functions
+ *              and are indexed by their id.
+ */
+typedef struct SimpleButton_Type_BtnTable_t {
+
+    const simpleButton_Type_TableConfig_t* config;
+
+    SimpleButton_Type_TableBtn_t*   buttons;
+
+    uint8_t                         count;
+
+} SimpleButton_Type_BtnTable_t;
+
+#endif /* SIMPLEBTN_MODE_ENABLE_BUTTON_TABLE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_MATRIX != 0
+
+/* struct for the status of one key of a key matrix (in RAM, no methods). */
+typedef struct SimpleButton_Type_MatrixKey_t {
+
+    simpleButton_Type_PrivateBtnStatus_t Private;
+
+    simpleButton_Type_PublicBtnStatus_t Public;
+
+} SimpleButton_Type_MatrixKey_t;
+
+/* struct for the scan status of a key matrix. */
+typedef struct simpleButton_Type_MatrixStatus_t {
+
+    volatile uint8_t                woken; /* a column EXTI came while the rows were parked */
+
+    uint8_t                         parked; /* all rows are driven low, waiting for a column EXTI */
+
+    uint16_t                        ghost; /* rows whose new pushes were blocked in the last scan (bit = row) */
+
+} simpleButton_Type_MatrixStatus_t;
+
+/**
+ * @typedef     SimpleButton_Type_Matrix_t
+ * 
+ * @brief       A key matrix created by `SIMPLEBTN__MATRIX_CREATE`. The rows
+ *              are open-drain outputs of one port, the columns are pull-up
+ *              inputs of one port. Key id = row * col_num + col.
+ */
+typedef struct SimpleButton_Type_Matrix_t {
+
+    simpleButton_Type_GPIOBase_t    row_base;
+
+    simpleButton_Type_GPIOBase_t    col_base;
+
+    const simpleButton_Type_GPIOPin_t* row_pins;
+
+    const simpleButton_Type_GPIOPin_t* col_pins;
+
+    simpleButton_Type_GPIOPin_t     row_mask;
+
+    simpleButton_Type_GPIOPin_t     col_mask;
+
+    uint8_t                         row_num;
+
+    uint8_t                         col_num;
+
+    uint8_t                         exti_wake; /* park the rows and wake up by the column EXTI while idle */
+
+    SimpleButton_Type_MatrixKey_t*  keys;
+
+    simpleButton_Type_GPIOPin_t*    pushed; /* pushed column pins of each row, after the ghost filter */
+
+    simpleButton_Type_MatrixStatus_t* status;
+
+} SimpleButton_Type_Matrix_t;
+
+#endif /* SIMPLEBTN_MODE_ENABLE_MATRIX != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_LADDER != 0
+
+/* struct for the config of one analog pin of a resistor ladder (in flash). */
+typedef struct simpleButton_Type_LadderChannel_t {
+
+    simpleButton_Type_GPIOBase_t    gpiox_base;
+
+    simpleButton_Type_GPIOPin_t     gpio_pin_x;
+
+    uint8_t                         adc_channel;
+
+} simpleButton_Type_LadderChannel_t;
+
+/* struct for the config of one key of a resistor ladder (in flash). */
+typedef struct simpleButton_Type_LadderLevel_t {
+
+    uint16_t                        level; /* the ADC value while this key is pushed */
+
+    uint8_t                         channel; /* the index of its pin in the channel list */
+
+} simpleButton_Type_LadderLevel_t;
+
+/* struct for the status of one key of a resistor ladder (in RAM, no methods). */
+typedef struct SimpleButton_Type_LadderKey_t {
+
+    simpleButton_Type_PrivateBtnStatus_t Private;
+
+    simpleButton_Type_PublicBtnStatus_t Public;
+
+} SimpleButton_Type_LadderKey_t;
+
+/**
+ * @typedef     SimpleButton_Type_Ladder_t
+ * 
+ * @brief       A resistor ladder created by `SIMPLEBTN__LADDER_CREATE`:
+ *              several keys on each analog pin, told apart by the voltage.
+ *              The ADC converts all pins in scan mode and the DMA fills
+ *              `samples` with `SIMPLEBTN_LADDER_BATCH` rounds, again and again.
+ */
+typedef struct SimpleButton_Type_Ladder_t {
+
+    const simpleButton_Type_LadderChannel_t* channels;
+
+    const simpleButton_Type_LadderLevel_t* levels;
+
+    SimpleButton_Type_LadderKey_t*  keys;
+
+    volatile uint16_t*              samples; /* the DMA buffer, round-major: samples[round * channel_num + channel] */
+
+    uint8_t*                        selected; /* the key of each channel after the last batch, or SIMPLEBTN_LADDER_NONE */
+
+    uint8_t                         channel_num;
+
+    uint8_t                         key_num;
+
+} SimpleButton_Type_Ladder_t;
+
+#endif /* SIMPLEBTN_MODE_ENABLE_LADDER != 0 */
+
+/* struct for one entry of the button registry. */
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+
+ #define SIMPLEBTN_REGISTRY_INVALID_ID      0xFF
+
+ typedef struct simpleButton_Type_RegistryEntry_t {
+
+    simpleButton_Type_PrivateBtnStatus_t*   self_private;
+
+    simpleButton_Type_PublicBtnStatus_t*    self_public;
+
+    simpleButton_Type_GPIOBase_t            gpiox_base;
+
+    simpleButton_Type_GPIOPin_t             gpio_pin_x;
+
+    simpleButton_Type_GPIOPinVal_t          normal_pin_val;
+
+    uint8_t                                 isDynamic; /* need polling or not */
+
+ #if SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0
+    uint8_t                                 portIndex; /* index of port snapshot */
+ #endif /* SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING != 0 */
+
+    simpleButton_Type_ShortPushCallBack_t   shortPushCallBack;
+
+    simpleButton_Type_LongPushCallBack_t    longPushCallBack;
+
+    simpleButton_Type_RepeatPushCallBack_t  repeatPushCallBack;
+
+ } simpleButton_Type_RegistryEntry_t;
+
+ #if SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0
+ /* Bit-sliced 2-bit debounce counters of one GPIO port (one bit per pin). */
+ typedef struct simpleButton_Type_VerticalCounter_t {
+
+    uint32_t                                cnt0; /* counter bit 0 */
+
+    uint32_t                                cnt1; /* counter bit 1 */
+
+    uint32_t                                stable; /* debounced level */
+
+ } simpleButton_Type_VerticalCounter_t;
+ #endif /* SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE != 0 */
+
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0
+
+/* enum for the type of button event. */
+typedef enum SimpleButton_Type_EventType_t {
+    SimpleButton_Event_Short_Push = 0,
+
+    SimpleButton_Event_Long_Push,
+
+    SimpleButton_Event_Repeat_Push,
+
+    SimpleButton_Event_Combination_Push,
+
+    SimpleButton_Event_Press, /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT only */
+
+    SimpleButton_Event_Release, /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT only */
+
+} SimpleButton_Type_EventType_t;
+
+/* struct for one record of the event queue. */
+typedef struct SimpleButton_Type_Event_t {
+
+    uint32_t                        timeStamp; /* tick when the event is detected */
+
+    uint16_t                        duration; /* ms since the (first) push, saturated */
+
+    uint8_t                         id; /* registry index of the button */
+
+    uint8_t                         type; /* SimpleButton_Type_EventType_t */
+
+    uint8_t                         repeatCount; /* push times of the event */
+
+} SimpleButton_Type_Event_t;
+
+#endif /* SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_TRACE != 0
+
+/* enum for the kind of trace record. */
+typedef enum SimpleButton_Type_TraceKind_t {
+    SimpleButton_Trace_Transition = 0, /* arg: the new state */
+
+    SimpleButton_Trace_Exti, /* arg: 1 if the edge started Push_Delay, 0 if ignored */
+
+    SimpleButton_Trace_CallBack, /* arg: SimpleButton_Trace_xxxCallBack, | 0x80 if queued as an event */
+
+    SimpleButton_Trace_TimeHigh, /* delta: bits 16 ~ 31 of the delta of the next record */
+
+} SimpleButton_Type_TraceKind_t;
+
+/* enum for the arg of SimpleButton_Trace_CallBack records. */
+typedef enum SimpleButton_Type_TraceCallBack_t {
+    SimpleButton_Trace_ShortPushCallBack = 0,
+
+    SimpleButton_Trace_LongPushCallBack,
+
+    SimpleButton_Trace_RepeatPushCallBack,
+
+    SimpleButton_Trace_CombinationCallBack,
+
+    SimpleButton_Trace_PressCallBack,
+
+    SimpleButton_Trace_ReleaseCallBack,
+
+} SimpleButton_Type_TraceCallBack_t;
+
+/* struct for one trace record (6 bytes). */
+typedef struct SimpleButton_Type_TraceRecord_t {
+
+    uint16_t                        delta; /* ms since the previous record */
+
+    uint16_t                        button; /* low 16 bits of the address of the Private status */
+
+    uint8_t                         kind; /* SimpleButton_Type_TraceKind_t */
+
+    uint8_t                         arg;
+
+} SimpleButton_Type_TraceRecord_t;
+
+/* struct for the trace ring buffer, dump it as it is for tools/sBtn_trace_decode.c */
+typedef struct SimpleButton_Type_Trace_t {
+
+    uint32_t                        magic; /* SIMPLEBTN__TRACE_MAGIC */
+
+    uint8_t                         recordSize; /* sizeof(SimpleButton_Type_TraceRecord_t) */
+
+    uint8_t                         states; /* bit 0: combination states, bit 1: long-push-hold states */
+
+    uint16_t                        size; /* SIMPLEBTN_TRACE_SIZE */
+
+    uint32_t                        head; /* number of records ever written */
+
+    uint32_t                        lastTime; /* tick of the newest record */
+
+    SimpleButton_Type_TraceRecord_t record[SIMPLEBTN_TRACE_SIZE]; /* record[head % size] is the next */
+
+} SimpleButton_Type_Trace_t;
+
+/* The magic number at the start of a trace dump ("SBTR") */
+#define SIMPLEBTN__TRACE_MAGIC          ((uint32_t)0x52544253UL)
+
+#endif /* SIMPLEBTN_MODE_ENABLE_TRACE != 0 */
+
+/* The deadline of a handler that only waits for the interrupt */
+#define SIMPLEBTN__DEADLINE_NEVER       ((uint32_t)0xFFFFFFFFUL)
+
+/**
+ * @brief   Pick the earlier one of two deadlines (returned by handlers).
+ *          Tick overflow is handled, `SIMPLEBTN__DEADLINE_NEVER` is the latest.
+ * @return  The earlier deadline.
+ */
+SIMPLEBTN_FORCE_INLINE uint32_t SimpleButton_EarlierDeadline(uint32_t deadline_a, uint32_t deadline_b) {
+    if (deadline_a == SIMPLEBTN__DEADLINE_NEVER) {
+        return deadline_b;
+    }
+    if (deadline_b == SIMPLEBTN__DEADLINE_NEVER) {
+        return deadline_a;
+    }
+    return ((int32_t)(deadline_a - deadline_b) <= 0) ? deadline_a : deadline_b;
+}
+
+#if SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0
+
+/* The EXTI lines of the shared interrupt vectors (for SimpleButton_EXTI_Dispatch) */
+ #define SIMPLEBTN__EXTI_LINES_ALL          ((uint32_t)0xFFFF)
+ #define SIMPLEBTN__EXTI_LINES_7_0          ((uint32_t)0x00FF)
+ #define SIMPLEBTN__EXTI_LINES_9_5          ((uint32_t)0x03E0)
+ #define SIMPLEBTN__EXTI_LINES_15_10        ((uint32_t)0xFC00)
+
+/* Bind the EXTI line of a pin to a button, for the dispatcher */
+SIMPLEBTN_C_API void simpleButton_Private_ExtiAttach(
+    simpleButton_Type_PrivateBtnStatus_t* self_private,
+    simpleButton_Type_GPIOPin_t gpio_pin_x
+);
+
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0 */
+
 /* Init the Button.Public */
 SIMPLEBTN_C_API void simpleButton_Private_InitStructPublic(
     simpleButton_Type_PublicBtnStatus_t* self_public
@@ -324,6 +926,10 @@ SIMPLEBTN_FORCE_INLINE void simpleButton_Private_InitButton(
         interruptHandler
     );
 
+#if SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0
+    simpleButton_Private_ExtiAttach(&(self->Private), GPIO_Pin_X);
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0 */
+
     SIMPLEBTN_FUNC_INIT_EXTI(
         GPIOX_BASE,
         GPIO_Pin_X,
@@ -334,17 +940,19 @@ SIMPLEBTN_FORCE_INLINE void simpleButton_Private_InitButton(
 
 
 SIMPLEBTN_C_API void simpleButton_Private_InterruptHandler(
-    simpleButton_Type_PrivateBtnStatus_t* self_private
+    simpleButton_Type_PrivateBtnStatus_t* self_private,
+    simpleButton_Type_GPIOPin_t gpio_pin_x
 );
 
 
-SIMPLEBTN_C_API void
+SIMPLEBTN_C_API uint32_t
 simpleButton_Private_AsynchronousHandler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
     simpleButton_Type_PublicBtnStatus_t* const self_public,
     const simpleButton_Type_GPIOBase_t gpiox_base,
     const simpleButton_Type_GPIOPin_t  gpio_pin_x,
     const simpleButton_Type_GPIOPinVal_t normal_pin_val,
+    const uint32_t now,
     simpleButton_Type_ShortPushCallBack_t shortPushCB,
     simpleButton_Type_LongPushCallBack_t longPushCB,
     simpleButton_Type_RepeatPushCallBack_t repeatPushCB
@@ -355,7 +963,13 @@ simpleButton_Private_AsynchronousHandler(
     || (defined(__cplusplus) && __cplusplus >= 201103L)
 
 SIMPLEBTN_FORCE_INLINE uint32_t simpleButton_Private_IsIdle(const simpleButton_Type_PrivateBtnStatus_t* self_private) {
+#if SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0
+    /* a dynamic-button still counting the samples of a change is busy */
+    return (self_private->state == simpleButton_State_Wait_For_Interrupt
+        && (self_private->integrator & SIMPLEBTN_INTEGRATE_COUNT) == 0);
+#else
     return (self_private->state == simpleButton_State_Wait_For_Interrupt);
+#endif /* SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE != 0 */
 }
 
 #define SIMPLEBTN_ISIDLE_1(Btn)         simpleButton_Private_IsIdle( &((Btn).Private) )
@@ -425,22 +1039,84 @@ SIMPLEBTN_FORCE_INLINE uint32_t simpleButton_Private_IsIdle(const simpleButton_T
 #define SIMPLEBTN_ALLISIDLE(...)    \
     SIMPLEBTN_CONNECT2(SIMPLEBTN_ISIDLE_, SIMPLEBTN_COUNT_ARGS(__VA_ARGS__))(__VA_ARGS__)
 
+/* The low-power entry of SIMPLEBTN__START_LOWPOWER (SLEEP or STOP) */
+#if SIMPLEBTN_MODE_ENABLE_DEEP_SLEEP != 0
+ #define SIMPLEBTN_START_LOWPOWER_ENTRY()   SIMPLEBTN_FUNC_START_DEEP_SLEEP()
+#else
+ #define SIMPLEBTN_START_LOWPOWER_ENTRY()   SIMPLEBTN_FUNC_START_LOW_POWER()
+#endif /* SIMPLEBTN_MODE_ENABLE_DEEP_SLEEP != 0 */
+
 /**
  * @brief   Start low power if all of the buttons are idle.
  * @param   __VA_ARGS__ - button object. (passing 1 ~ 32 parameters is OK)
+ * @note    In deep-sleep mode, the chip enters STOP mode and the tick is
+ *          advanced by the slept time before the waking EXTI is served.
  * @return  None
  */
 #define SIMPLEBTN__START_LOWPOWER(...)  \
     do {                                            \
         SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN();    \
         if (SIMPLEBTN_ALLISIDLE(__VA_ARGS__)) {     \
-            SIMPLEBTN_FUNC_START_LOW_POWER();       \
+            SIMPLEBTN_START_LOWPOWER_ENTRY();       \
         }                                           \
         SIMPLEBTN_FUNC_CRITICAL_SECTION_END();      \
     } while (0)
 
 #endif /* >= C99 or C++11 */
 
+/* The normal(didn't push) pin value of an EXTI button */
+#define SIMPLEBTN_NORMAL_PIN_VAL(EXTI_Trigger_x)                                \
+    ((simpleButton_Type_GPIOPinVal_t)                                           \
+    (((EXTI_Trigger_x) == SIMPLEBTN_EXTI_TRIGGER_FALLING) ? 1 : 0))
+
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+
+SIMPLEBTN_C_API uint8_t simpleButton_Private_RegistryAdd(
+    simpleButton_Type_PrivateBtnStatus_t* self_private,
+    simpleButton_Type_PublicBtnStatus_t* self_public,
+    simpleButton_Type_GPIOBase_t gpiox_base,
+    simpleButton_Type_GPIOPin_t gpio_pin_x,
+    simpleButton_Type_GPIOPinVal_t normal_pin_val,
+    uint8_t isDynamic,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+);
+
+/* Generate the `_Register` function of a static button */
+ #define SIMPLEBTN_CREATE_REGISTER(GPIOx_BASE, GPIO_Pin_x, EXTI_Trigger_x, __name) \
+    SIMPLEBTN_C_API uint8_t                                                     \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Register)(                 \
+        simpleButton_Type_ShortPushCallBack_t  shortPushCallBack,               \
+        simpleButton_Type_LongPushCallBack_t   longPushCallBack,                \
+        simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack               \
+    ) {                                                                         \
+        return simpleButton_Private_RegistryAdd(                                \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name).Private),         \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name).Public),          \
+            (GPIOx_BASE),                                                       \
+            (GPIO_Pin_x),                                                       \
+            SIMPLEBTN_NORMAL_PIN_VAL(EXTI_Trigger_x),                           \
+            0,                                                                  \
+            shortPushCallBack,                                                  \
+            longPushCallBack,                                                   \
+            repeatPushCallBack                                                  \
+        );                                                                      \
+    }
+
+ #define SIMPLEBTN_DECLARE_REGISTER(__name)                                     \
+    SIMPLEBTN_C_API uint8_t                                                     \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Register)(                 \
+        simpleButton_Type_ShortPushCallBack_t  shortPushCallBack,               \
+        simpleButton_Type_LongPushCallBack_t   longPushCallBack,                \
+        simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack               \
+    );
+
+#else
+ #define SIMPLEBTN_CREATE_REGISTER(GPIOx_BASE, GPIO_Pin_x, EXTI_Trigger_x, __name)
+ #define SIMPLEBTN_DECLARE_REGISTER(__name)
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
+
 
 /**
  * @def         SIMPLEBTN__CREATE
@@ -455,22 +1131,37 @@ SIMPLEBTN_FORCE_INLINE uint32_t simpleButton_Private_IsIdle(const simpleButton_T
     simpleButton_Type_Button_t                                                  \
     SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name) = {0};                      \
                                                                                 \
-    static void                                                                 \
-    SIMPLEBTN_CONNECT2(simpleButton_Private_AsyHandler_, __name)(               \
+    SIMPLEBTN_C_API uint32_t                                                    \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _HandlerAt)(                \
+        const uint32_t now,                                                     \
         simpleButton_Type_ShortPushCallBack_t  shortPushCallBack,               \
         simpleButton_Type_LongPushCallBack_t   longPushCallBack,                \
         simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack               \
     ) {                                                                         \
         const simpleButton_Type_GPIOPinVal_t normalPinVal =                     \
-            (simpleButton_Type_GPIOPinVal_t)                                    \
-            (((EXTI_Trigger_x) == SIMPLEBTN_EXTI_TRIGGER_FALLING) ? 1 : 0);     \
+            SIMPLEBTN_NORMAL_PIN_VAL(EXTI_Trigger_x);                           \
                                                                                 \
-        simpleButton_Private_AsynchronousHandler(                               \
+        return simpleButton_Private_AsynchronousHandler(                        \
             &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name).Private),         \
             &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name).Public),          \
             (GPIOx_BASE),                                                       \
             (GPIO_Pin_x),                                                       \
             normalPinVal,                                                       \
+            now,                                                                \
+            shortPushCallBack,                                                  \
+            longPushCallBack,                                                   \
+            repeatPushCallBack                                                  \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static uint32_t                                                             \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_AsyHandler_, __name)(               \
+        simpleButton_Type_ShortPushCallBack_t  shortPushCallBack,               \
+        simpleButton_Type_LongPushCallBack_t   longPushCallBack,                \
+        simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack               \
+    ) {                                                                         \
+        return SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _HandlerAt)(     \
+            SIMPLEBTN_FUNC_GET_TICK(),                                          \
             shortPushCallBack,                                                  \
             longPushCallBack,                                                   \
             repeatPushCallBack                                                  \
@@ -480,7 +1171,8 @@ SIMPLEBTN_FORCE_INLINE uint32_t simpleButton_Private_IsIdle(const simpleButton_T
     static void                                                                 \
     SIMPLEBTN_CONNECT2(simpleButton_Private_ITHandler_, __name)(void) {         \
         simpleButton_Private_InterruptHandler(                                  \
-            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name).Private)          \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name).Private),         \
+            (GPIO_Pin_x)                                                        \
         );                                                                      \
     }                                                                           \
                                                                                 \
@@ -494,7 +1186,9 @@ SIMPLEBTN_FORCE_INLINE uint32_t simpleButton_Private_IsIdle(const simpleButton_T
             &(SIMPLEBTN_CONNECT2(simpleButton_Private_AsyHandler_, __name)),    \
             &(SIMPLEBTN_CONNECT2(simpleButton_Private_ITHandler_, __name))      \
         );                                                                      \
-    }
+    }                                                                           \
+                                                                                \
+    SIMPLEBTN_CREATE_REGISTER(GPIOx_BASE, GPIO_Pin_x, EXTI_Trigger_x, __name)
 
 
 /**
@@ -506,7 +1200,15 @@ SIMPLEBTN_FORCE_INLINE uint32_t simpleButton_Private_IsIdle(const simpleButton_T
     extern simpleButton_Type_Button_t                                           \
     SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
     SIMPLEBTN_C_API void                                                        \
-    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(void);
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(void);               \
+    SIMPLEBTN_C_API uint32_t                                                    \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _HandlerAt)(                \
+        const uint32_t now,                                                     \
+        simpleButton_Type_ShortPushCallBack_t  shortPushCallBack,               \
+        simpleButton_Type_LongPushCallBack_t   longPushCallBack,                \
+        simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack               \
+    );                                                                          \
+    SIMPLEBTN_DECLARE_REGISTER(__name)
 
 
 #if ( SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 )
@@ -531,6 +1233,302 @@ SIMPLEBTN_FORCE_INLINE uint32_t simpleButton_Private_IsIdle(const simpleButton_T
 
 #endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
 
+#if ( SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 )
+
+/**
+ * @def             SIMPLEBTN__REGISTER
+ * @brief           Add a static button to the registry, so that it is handled
+ *                  by `SimpleButton_ProcessAll()`.
+ *
+ * @param[in]       __name - The name of the button (created by `SIMPLEBTN__CREATE`).
+ * @param[in]       shortPushCallBack - callback function for short push.
+ * @param[in]       longPushCallBack - callback function for long push.
+ * @param[in]       repeatPushCallBack - callback function for repeat push.
+ *
+ * @return          The id (registry index) of the button,
+ *                  or `SIMPLEBTN_REGISTRY_INVALID_ID` if the registry is full.
+ *
+ * @attention       Make sure the macro `SIMPLEBTN_MODE_ENABLE_REGISTRY` is defined as 1.
+ */
+ #define SIMPLEBTN__REGISTER(__name, shortPushCallBack, longPushCallBack, repeatPushCallBack) \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Register)(                 \
+        shortPushCallBack, longPushCallBack, repeatPushCallBack)
+
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
+
+#if ( SIMPLEBTN_MODE_ENABLE_BUTTON_TABLE != 0 )
+
+/* X-macro element: the config of one table button */
+ #define SIMPLEBTN_TABLE_CONFIG(GPIOx_BASE, GPIO_Pin_x, EXTI_Trigger_x, __name)  \
+    {                                                                           \
+        (GPIOx_BASE),                                                           \
+        (GPIO_Pin_x),                                                           \
+        SIMPLEBTN_NORMAL_PIN_VAL(EXTI_Trigger_x),                               \
+        (uint8_t)(EXTI_Trigger_x)                                               \
+    },
+
+/* Constant initializer of a table button, same values as `simpleButton_Private_InitStructXxx` */
+#if SIMPLEBTN_MODE_ENABLE_COMBINATION != 0
+ #define SIMPLEBTN_PUBLIC_INIT_CMB      { 0, 0 },
+#else
+ #define SIMPLEBTN_PUBLIC_INIT_CMB
+#endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0
+ #define SIMPLEBTN_PUBLIC_INIT_PRESS    0, 0,
+#else
+ #define SIMPLEBTN_PUBLIC_INIT_PRESS
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 && SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
+ #define SIMPLEBTN_PUBLIC_INIT_TIME     SIMPLEBTN_TIME_HOLD_PUSH_MIN, SIMPLEBTN_TIME_LONG_PUSH_MIN, \
+                                        SIMPLEBTN_TIME_COOL_DOWN, SIMPLEBTN_TIME_REPEAT_WINDOW,
+#elif SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
+ #define SIMPLEBTN_PUBLIC_INIT_TIME     SIMPLEBTN_TIME_LONG_PUSH_MIN, \
+                                        SIMPLEBTN_TIME_COOL_DOWN, SIMPLEBTN_TIME_REPEAT_WINDOW,
+#else
+ #define SIMPLEBTN_PUBLIC_INIT_TIME
+#endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 || SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
+ #define SIMPLEBTN_TABLE_BTN_INIT       \
+    { {0}, { SIMPLEBTN_PUBLIC_INIT_CMB SIMPLEBTN_PUBLIC_INIT_PRESS SIMPLEBTN_PUBLIC_INIT_TIME } }
+#else
+ #define SIMPLEBTN_TABLE_BTN_INIT       { {0} }
+#endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 || SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
+
+/* X-macro element: the initial status of one table button */
+ #define SIMPLEBTN_TABLE_STATUS(GPIOx_BASE, GPIO_Pin_x, EXTI_Trigger_x, __name)  \
+    SIMPLEBTN_TABLE_BTN_INIT,
+
+/* X-macro element: the id of one table button */
+ #define SIMPLEBTN_TABLE_ID(GPIOx_BASE, GPIO_Pin_x, EXTI_Trigger_x, __name)      \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _ID),
+
+/**
+ * @def         SIMPLEBTN__TABLE_CREATE
+ * @brief       Create a table of buttons from an X-macro list.
+ * @param[in]   __table - The name of the table.
+ * @param[in]   __list - The X-macro list, each element is
+ *              `X(GPIOx_BASE, GPIO_Pin_x, EXTI_Trigger_x, __name)`.
+ * @note        The config of the buttons is a const array (in flash), only
+ *              their status is in RAM (constant-initialized, no runtime fill).
+ *              No function is generated per button.
+ * @attention   Make sure the macro `SIMPLEBTN_MODE_ENABLE_BUTTON_TABLE` is defined as 1.
+ */
+ #define SIMPLEBTN__TABLE_CREATE(__table, __list)                               \
+    static const simpleButton_Type_TableConfig_t                                \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_TableConfig_, __table)[] = {        \
+        __list(SIMPLEBTN_TABLE_CONFIG)                                          \
+    };                                                                          \
+                                                                                \
+    static SimpleButton_Type_TableBtn_t                                         \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_TableBtn_, __table)[] = {           \
+        __list(SIMPLEBTN_TABLE_STATUS)                                          \
+    };                                                                          \
+                                                                                \
+    extern const SimpleButton_Type_BtnTable_t                                   \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __table);                           \
+    const SimpleButton_Type_BtnTable_t                                          \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __table) = {                        \
+        SIMPLEBTN_CONNECT2(simpleButton_Private_TableConfig_, __table),         \
+        SIMPLEBTN_CONNECT2(simpleButton_Private_TableBtn_, __table),            \
+        (uint8_t)(                                                              \
+            sizeof(SIMPLEBTN_CONNECT2(simpleButton_Private_TableConfig_, __table)) \
+            / sizeof(simpleButton_Type_TableConfig_t)                           \
+        )                                                                       \
+    };
+
+/**
+ * @def         SIMPLEBTN__TABLE_DECLARE
+ * @brief       Declare a table of buttons and the ids of its buttons
+ *              (`prefix/namespace` + `__name` + `_ID`).
+ * @param[in]   __table - The name of the table.
+ * @param[in]   __list - The same X-macro list as the one used to create it.
+ */
+ #define SIMPLEBTN__TABLE_DECLARE(__table, __list)                              \
+    enum {                                                                      \
+        __list(SIMPLEBTN_TABLE_ID)                                              \
+        SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __table, _COUNT)                \
+    };                                                                          \
+    extern const SimpleButton_Type_BtnTable_t                                   \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __table);
+
+#endif /* SIMPLEBTN_MODE_ENABLE_BUTTON_TABLE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_MATRIX != 0
+
+/* X-macro elements of the row / column lists of a key matrix */
+ #define SIMPLEBTN_MATRIX_PIN(GPIO_Pin_x)       (GPIO_Pin_x),
+ #define SIMPLEBTN_MATRIX_MASK(GPIO_Pin_x)      | (GPIO_Pin_x)
+ #define SIMPLEBTN_MATRIX_ONE(GPIO_Pin_x)       + 1
+
+/**
+ * @def         SIMPLEBTN__MATRIX_CREATE
+ * @brief       Create a key matrix from two X-macro lists of pins.
+ * @param[in]   __matrix - The name of the matrix.
+ * @param[in]   ROWx_BASE - The GPIO port of the rows.
+ * @param[in]   __rows - The X-macro list of the row pins, each element is `X(GPIO_Pin_x)`.
+ * @param[in]   COLx_BASE - The GPIO port of the columns.
+ * @param[in]   __cols - The X-macro list of the column pins, each element is `X(GPIO_Pin_x)`.
+ * @param[in]   __extiWake - 1: park the rows low and wake up by the column EXTI while idle.
+ * @note        Only the status of the keys and one mask per row are in RAM.
+ *              At most 16 rows and 256 keys (key id is `uint8_t`), a larger
+ *              matrix fails to compile.
+ * @attention   Make sure the macro `SIMPLEBTN_MODE_ENABLE_MATRIX` is defined as 1.
+ */
+ #define SIMPLEBTN__MATRIX_CREATE(__matrix, ROWx_BASE, __rows, COLx_BASE, __cols, __extiWake) \
+    typedef char SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixSizeCheck_, __matrix)[ \
+        ((0 __rows(SIMPLEBTN_MATRIX_ONE)) <= 16                                 \
+        && (0 __rows(SIMPLEBTN_MATRIX_ONE)) * (0 __cols(SIMPLEBTN_MATRIX_ONE)) <= 256) ? 1 : -1]; \
+                                                                                \
+    static const simpleButton_Type_GPIOPin_t                                    \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixRowPin_, __matrix)[] = {      \
+        __rows(SIMPLEBTN_MATRIX_PIN)                                            \
+    };                                                                          \
+                                                                                \
+    static const simpleButton_Type_GPIOPin_t                                    \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixColPin_, __matrix)[] = {      \
+        __cols(SIMPLEBTN_MATRIX_PIN)                                            \
+    };                                                                          \
+                                                                                \
+    static SimpleButton_Type_MatrixKey_t                                        \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixKey_, __matrix)               \
+        [(0 __rows(SIMPLEBTN_MATRIX_ONE)) * (0 __cols(SIMPLEBTN_MATRIX_ONE))];  \
+                                                                                \
+    static simpleButton_Type_GPIOPin_t                                          \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixPushed_, __matrix)            \
+        [0 __rows(SIMPLEBTN_MATRIX_ONE)];                                       \
+                                                                                \
+    static simpleButton_Type_MatrixStatus_t                                     \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixStatus_, __matrix);           \
+                                                                                \
+    extern const SimpleButton_Type_Matrix_t                                     \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __matrix);                          \
+    const SimpleButton_Type_Matrix_t                                            \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __matrix) = {                       \
+        (ROWx_BASE),                                                            \
+        (COLx_BASE),                                                            \
+        SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixRowPin_, __matrix),       \
+        SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixColPin_, __matrix),       \
+        (simpleButton_Type_GPIOPin_t)(0 __rows(SIMPLEBTN_MATRIX_MASK)),         \
+        (simpleButton_Type_GPIOPin_t)(0 __cols(SIMPLEBTN_MATRIX_MASK)),         \
+        (uint8_t)(0 __rows(SIMPLEBTN_MATRIX_ONE)),                              \
+        (uint8_t)(0 __cols(SIMPLEBTN_MATRIX_ONE)),                              \
+        (uint8_t)(__extiWake),                                                  \
+        SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixKey_, __matrix),          \
+        SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixPushed_, __matrix),       \
+        &SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixStatus_, __matrix)       \
+    };
+
+/**
+ * @def         SIMPLEBTN__MATRIX_DECLARE
+ * @brief       Declare a key matrix and its sizes (`prefix/namespace` +
+ *              `__matrix` + `_ROWS` / `_COLS` / `_COUNT`).
+ * @param[in]   __matrix - The name of the matrix.
+ * @param[in]   __rows / __cols - The same X-macro lists as the ones used to create it.
+ */
+ #define SIMPLEBTN__MATRIX_DECLARE(__matrix, __rows, __cols)                    \
+    enum {                                                                      \
+        SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __matrix, _ROWS) = 0 __rows(SIMPLEBTN_MATRIX_ONE), \
+        SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __matrix, _COLS) = 0 __cols(SIMPLEBTN_MATRIX_ONE), \
+        SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __matrix, _COUNT) =             \
+            (0 __rows(SIMPLEBTN_MATRIX_ONE)) * (0 __cols(SIMPLEBTN_MATRIX_ONE)) \
+    };                                                                          \
+    extern const SimpleButton_Type_Matrix_t                                     \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __matrix);
+
+#endif /* SIMPLEBTN_MODE_ENABLE_MATRIX != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_LADDER != 0
+
+/* X-macro elements of the channel / key lists of a resistor ladder */
+ #define SIMPLEBTN_LADDER_CHANNEL(ADC_Channel_x, GPIOx_BASE, GPIO_Pin_x)       \
+    { (GPIOx_BASE), (GPIO_Pin_x), (uint8_t)(ADC_Channel_x) },
+ #define SIMPLEBTN_LADDER_CHANNEL_ONE(ADC_Channel_x, GPIOx_BASE, GPIO_Pin_x)   + 1
+ #define SIMPLEBTN_LADDER_LEVEL(__channel, __level, __name)                    \
+    { (uint16_t)(__level), (uint8_t)(__channel) },
+ #define SIMPLEBTN_LADDER_ID(__channel, __level, __name)                       \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _ID),
+
+/**
+ * @def         SIMPLEBTN__LADDER_CREATE
+ * @brief       Create a resistor ladder from two X-macro lists.
+ * @param[in]   __ladder - The name of the ladder.
+ * @param[in]   __channels - The X-macro list of the analog pins, each element is
+ *              `X(ADC_Channel_x, GPIOx_BASE, GPIO_Pin_x)`. Converted in this order.
+ * @param[in]   __keys - The X-macro list of the keys, each element is
+ *              `X(__channel, __level, __name)`: the index of its pin in
+ *              `__channels`, its ADC value while pushed, and its name.
+ * @note        The config is const (in flash). The DMA buffer holds
+ *              `SIMPLEBTN_LADDER_BATCH` conversion rounds of all pins.
+ *              At most 255 pins and 254 keys (0xFF is "no key"), a larger
+ *              ladder fails to compile. A key whose pin index is not in
+ *              `__channels` is never pushed.
+ * @attention   Make sure the macro `SIMPLEBTN_MODE_ENABLE_LADDER` is defined as 1.
+ */
+ #define SIMPLEBTN__LADDER_CREATE(__ladder, __channels, __keys)                 \
+    static const simpleButton_Type_LadderChannel_t                              \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_LadderChannel_, __ladder)[] = {     \
+        __channels(SIMPLEBTN_LADDER_CHANNEL)                                    \
+    };                                                                          \
+                                                                                \
+    static const simpleButton_Type_LadderLevel_t                                \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_LadderLevel_, __ladder)[] = {       \
+        __keys(SIMPLEBTN_LADDER_LEVEL)                                          \
+    };                                                                          \
+                                                                                \
+    typedef char SIMPLEBTN_CONNECT2(simpleButton_Private_LadderSizeCheck_, __ladder)[ \
+        ((0 __channels(SIMPLEBTN_LADDER_CHANNEL_ONE)) <= 255                    \
+        && sizeof(SIMPLEBTN_CONNECT2(simpleButton_Private_LadderLevel_, __ladder)) \
+        / sizeof(simpleButton_Type_LadderLevel_t) <= 254) ? 1 : -1];            \
+                                                                                \
+    static SimpleButton_Type_LadderKey_t                                        \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_LadderKey_, __ladder)               \
+        [sizeof(SIMPLEBTN_CONNECT2(simpleButton_Private_LadderLevel_, __ladder)) \
+        / sizeof(simpleButton_Type_LadderLevel_t)];                             \
+                                                                                \
+    static volatile uint16_t                                                    \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_LadderSample_, __ladder)            \
+        [SIMPLEBTN_LADDER_BATCH * (0 __channels(SIMPLEBTN_LADDER_CHANNEL_ONE))]; \
+                                                                                \
+    static uint8_t                                                              \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_LadderSelected_, __ladder)          \
+        [0 __channels(SIMPLEBTN_LADDER_CHANNEL_ONE)];                           \
+                                                                                \
+    extern const SimpleButton_Type_Ladder_t                                     \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __ladder);                          \
+    const SimpleButton_Type_Ladder_t                                            \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __ladder) = {                       \
+        SIMPLEBTN_CONNECT2(simpleButton_Private_LadderChannel_, __ladder),      \
+        SIMPLEBTN_CONNECT2(simpleButton_Private_LadderLevel_, __ladder),        \
+        SIMPLEBTN_CONNECT2(simpleButton_Private_LadderKey_, __ladder),          \
+        SIMPLEBTN_CONNECT2(simpleButton_Private_LadderSample_, __ladder),       \
+        SIMPLEBTN_CONNECT2(simpleButton_Private_LadderSelected_, __ladder),      \
+        (uint8_t)(0 __channels(SIMPLEBTN_LADDER_CHANNEL_ONE)),                  \
+        (uint8_t)(                                                              \
+            sizeof(SIMPLEBTN_CONNECT2(simpleButton_Private_LadderLevel_, __ladder)) \
+            / sizeof(simpleButton_Type_LadderLevel_t)                           \
+        )                                                                       \
+    };
+
+/**
+ * @def         SIMPLEBTN__LADDER_DECLARE
+ * @brief       Declare a resistor ladder and the ids of its keys
+ *              (`prefix/namespace` + `__name` + `_ID`).
+ * @param[in]   __ladder - The name of the ladder.
+ * @param[in]   __keys - The same X-macro list of keys as the one used to create it.
+ */
+ #define SIMPLEBTN__LADDER_DECLARE(__ladder, __keys)                            \
+    enum {                                                                      \
+        __keys(SIMPLEBTN_LADDER_ID)                                             \
+        SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __ladder, _COUNT)               \
+    };                                                                          \
+    extern const SimpleButton_Type_Ladder_t                                     \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __ladder);
+
+#endif /* SIMPLEBTN_MODE_ENABLE_LADDER != 0 */
+
 SIMPLEBTN_C_API void
 SimpleButton_DynamicButton_Init(
     SimpleButton_Type_DynamicBtn_t* const self,
@@ -539,7 +1537,7 @@ SimpleButton_DynamicButton_Init(
     simpleButton_Type_GPIOPinVal_t  inactiveLevel
 );
 
-SIMPLEBTN_C_API void
+SIMPLEBTN_C_API uint32_t
 SimpleButton_DynamicButton_Handler(
     SimpleButton_Type_DynamicBtn_t* const self,
     simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
@@ -547,4 +1545,148 @@ SimpleButton_DynamicButton_Handler(
     simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
 );
 
+SIMPLEBTN_C_API uint32_t
+SimpleButton_DynamicButton_HandlerAt(
+    SimpleButton_Type_DynamicBtn_t* const self,
+    const uint32_t now,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+);
+
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+
+SIMPLEBTN_C_API uint8_t
+SimpleButton_DynamicButton_Register(
+    SimpleButton_Type_DynamicBtn_t* const self,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+);
+
+SIMPLEBTN_C_API uint32_t SimpleButton_ProcessAll(void);
+
+SIMPLEBTN_C_API uint32_t SimpleButton_ProcessAllAt(const uint32_t now);
+
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0
+
+SIMPLEBTN_C_API void SimpleButton_EXTI_Dispatch(const uint32_t EXTI_Lines);
+
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_BUTTON_TABLE != 0
+
+SIMPLEBTN_C_API void SimpleButton_Table_Init(const SimpleButton_Type_BtnTable_t* const table);
+
+SIMPLEBTN_C_API void
+SimpleButton_Table_InterruptHandler(const SimpleButton_Type_BtnTable_t* const table, const uint8_t id);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Table_Handler(
+    const SimpleButton_Type_BtnTable_t* const table,
+    const uint8_t id,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Table_HandlerAt(
+    const SimpleButton_Type_BtnTable_t* const table,
+    const uint8_t id,
+    const uint32_t now,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+);
+
+SIMPLEBTN_C_API uint8_t SimpleButton_Table_IsIdle(const SimpleButton_Type_BtnTable_t* const table);
+
+ #if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+
+SIMPLEBTN_C_API uint8_t
+SimpleButton_Table_Register(
+    const SimpleButton_Type_BtnTable_t* const table,
+    const uint8_t id,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+);
+
+ #endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
+
+#endif /* SIMPLEBTN_MODE_ENABLE_BUTTON_TABLE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_MATRIX != 0
+
+SIMPLEBTN_C_API void SimpleButton_Matrix_Init(const SimpleButton_Type_Matrix_t* const matrix);
+
+SIMPLEBTN_C_API void SimpleButton_Matrix_InterruptHandler(const SimpleButton_Type_Matrix_t* const matrix);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Matrix_ScanAt(const SimpleButton_Type_Matrix_t* const matrix, const uint32_t now);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Matrix_HandlerAt(
+    const SimpleButton_Type_Matrix_t* const matrix,
+    const uint8_t key,
+    const uint32_t now,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+);
+
+SIMPLEBTN_C_API uint8_t SimpleButton_Matrix_IsIdle(const SimpleButton_Type_Matrix_t* const matrix);
+
+#endif /* SIMPLEBTN_MODE_ENABLE_MATRIX != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_LADDER != 0
+
+SIMPLEBTN_C_API void SimpleButton_Ladder_Init(const SimpleButton_Type_Ladder_t* const ladder);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Ladder_ScanAt(const SimpleButton_Type_Ladder_t* const ladder, const uint32_t now);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Ladder_HandlerAt(
+    const SimpleButton_Type_Ladder_t* const ladder,
+    const uint8_t key,
+    const uint32_t now,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+);
+
+SIMPLEBTN_C_API uint8_t SimpleButton_Ladder_IsIdle(const SimpleButton_Type_Ladder_t* const ladder);
+
+#endif /* SIMPLEBTN_MODE_ENABLE_LADDER != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0
+
+SIMPLEBTN_C_API uint8_t SimpleButton_EventQueue_Pop(SimpleButton_Type_Event_t* const event);
+
+SIMPLEBTN_C_API uint32_t SimpleButton_EventQueue_GetDropped(void);
+
+#endif /* SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_PROFILING != 0
+
+SIMPLEBTN_C_API void SimpleButton_Profile_Read(const uint8_t site, SimpleButton_Type_ProfStat_t* const stat);
+
+SIMPLEBTN_C_API void SimpleButton_Profile_Clear(SimpleButton_Type_ProfStat_t* const stat);
+
+SIMPLEBTN_C_API void SimpleButton_Profile_Reset(void);
+
+#endif /* SIMPLEBTN_MODE_ENABLE_PROFILING != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_TRACE != 0
+
+SIMPLEBTN_C_API const SimpleButton_Type_Trace_t* SimpleButton_Trace_Get(void);
+
+SIMPLEBTN_C_API void SimpleButton_Trace_Clear(void);
+
+#endif /* SIMPLEBTN_MODE_ENABLE_TRACE != 0 */
+
 #endif /* SIMPLEBUTTON_H__ */
@@ -0,0 +1,447 @@
+/**
+ * @file            Simple_Button.hpp
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header-only C++ front end of Simple-Button. The port, pin,
+ *                  trigger, timings and callbacks of a button are template
+ *                  parameters, so each button compiles to its own inlined
+ *                  State-Machine: no per-button timing in RAM and no
+ *                  indirect calls.
+ *
+ * @version         0.8.x
+ *
+ * @date            2026-10-17
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_HPP__
+#define     SIMPLEBUTTON_HPP__      1019L
+
+#include    "Simple_Button.h"
+
+#if !defined(__cplusplus) || (__cplusplus < 201103L)
+ #error [Simple-Button] : "Simple_Button.hpp" needs C++11 or later.
+#endif /* !defined(__cplusplus) || (__cplusplus < 201103L) */
+
+namespace SimpleButton {
+
+/**
+ * @struct      Timing
+ *
+ * @brief       A timing profile (in ticks), the default values come from
+ *              "simple_button_config.h".
+ *
+ * @note        The values are compile-time constants, they take no RAM.
+ */
+template <
+    uint32_t PushDelay      = SIMPLEBTN_TIME_PUSH_DELAY,
+    uint32_t ReleaseDelay   = SIMPLEBTN_TIME_RELEASE_DELAY,
+    uint32_t LongPushMin    = SIMPLEBTN_TIME_LONG_PUSH_MIN,
+    uint32_t RepeatWindow   = SIMPLEBTN_TIME_REPEAT_WINDOW,
+    uint32_t CoolDown       = SIMPLEBTN_TIME_COOL_DOWN,
+    uint32_t Timeout        = SIMPLEBTN_TIME__TIMEOUT_NORMAL
+>
+struct Timing {
+    static constexpr uint32_t pushDelay     = PushDelay;
+    static constexpr uint32_t releaseDelay  = ReleaseDelay;
+    static constexpr uint32_t longPushMin   = LongPushMin;
+    static constexpr uint32_t repeatWindow  = RepeatWindow;
+    static constexpr uint32_t coolDown      = CoolDown;
+    static constexpr uint32_t timeout       = Timeout;
+
+    static_assert(PushDelay < Timeout && LongPushMin < Timeout,
+        "[Simple-Button] : the timeout must be longer than the push delay and the long push");
+};
+
+/* Definitions of the constants (needed if they are odr-used before C++17) */
+template <uint32_t P, uint32_t R, uint32_t L, uint32_t W, uint32_t C, uint32_t T>
+constexpr uint32_t Timing<P, R, L, W, C, T>::pushDelay;
+template <uint32_t P, uint32_t R, uint32_t L, uint32_t W, uint32_t C, uint32_t T>
+constexpr uint32_t Timing<P, R, L, W, C, T>::releaseDelay;
+template <uint32_t P, uint32_t R, uint32_t L, uint32_t W, uint32_t C, uint32_t T>
+constexpr uint32_t Timing<P, R, L, W, C, T>::longPushMin;
+template <uint32_t P, uint32_t R, uint32_t L, uint32_t W, uint32_t C, uint32_t T>
+constexpr uint32_t Timing<P, R, L, W, C, T>::repeatWindow;
+template <uint32_t P, uint32_t R, uint32_t L, uint32_t W, uint32_t C, uint32_t T>
+constexpr uint32_t Timing<P, R, L, W, C, T>::coolDown;
+template <uint32_t P, uint32_t R, uint32_t L, uint32_t W, uint32_t C, uint32_t T>
+constexpr uint32_t Timing<P, R, L, W, C, T>::timeout;
+
+/**
+ * @struct      Callbacks
+ *
+ * @brief       The callbacks of a button, `nullptr` means "not used".
+ *
+ * @note        The signatures follow the modes, e.g. the long push callback
+ *              takes the push time if `SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH` is 1.
+ */
+template <
+    simpleButton_Type_ShortPushCallBack_t   ShortPush   = nullptr,
+    simpleButton_Type_LongPushCallBack_t    LongPush    = nullptr,
+    simpleButton_Type_RepeatPushCallBack_t  RepeatPush  = nullptr
+>
+struct Callbacks {
+    static constexpr simpleButton_Type_ShortPushCallBack_t  shortPush   = ShortPush;
+    static constexpr simpleButton_Type_LongPushCallBack_t   longPush    = LongPush;
+    static constexpr simpleButton_Type_RepeatPushCallBack_t repeatPush  = RepeatPush;
+};
+
+template <simpleButton_Type_ShortPushCallBack_t S, simpleButton_Type_LongPushCallBack_t L, simpleButton_Type_RepeatPushCallBack_t R>
+constexpr simpleButton_Type_ShortPushCallBack_t Callbacks<S, L, R>::shortPush;
+template <simpleButton_Type_ShortPushCallBack_t S, simpleButton_Type_LongPushCallBack_t L, simpleButton_Type_RepeatPushCallBack_t R>
+constexpr simpleButton_Type_LongPushCallBack_t Callbacks<S, L, R>::longPush;
+template <simpleButton_Type_ShortPushCallBack_t S, simpleButton_Type_LongPushCallBack_t L, simpleButton_Type_RepeatPushCallBack_t R>
+constexpr simpleButton_Type_RepeatPushCallBack_t Callbacks<S, L, R>::repeatPush;
+
+/**
+ * @class       Button
+ *
+ * @brief       An EXTI button with compile-time config.
+ *              Only the status below is in RAM.
+ *
+ * @note        Supports short / long / repeat push (and the timer-long-push and
+ *              counter-repeat-push modes). Combination, long-push-hold, the
+ *              press / release events, the adaptive debounce and the event
+ *              queue are only provided by the C API.
+ *
+ * @example     using Key1 = SimpleButton::Button<GPIOA_BASE, GPIO_Pin_0, EXTI_Trigger_Falling,
+ *                  SimpleButton::Timing<20, 20, 800>, SimpleButton::Callbacks<OnShort, OnLong>>;
+ *              static Key1 key1;
+ *              // key1.Init(); key1.InterruptHandler() in the EXTI ISR; key1.Handler() in the loop.
+ */
+template <
+    simpleButton_Type_GPIOBase_t    Port,
+    simpleButton_Type_GPIOPin_t     Pin,
+    simpleButton_Type_EXTITrigger_t Trigger,
+    class                           TimingProfile   = Timing<>,
+    class                           CallbackSet     = Callbacks<>
+>
+class Button {
+public:
+
+    static constexpr simpleButton_Type_GPIOBase_t   port = Port;
+    static constexpr simpleButton_Type_GPIOPin_t    pin = Pin;
+    static constexpr simpleButton_Type_GPIOPinVal_t normalPinVal = SIMPLEBTN_NORMAL_PIN_VAL(Trigger);
+
+    /* Constant-initialized, `Init()` only has to set up the EXTI */
+    constexpr Button() : timeStamp_loop(0), timeStamp_interrupt(0),
+        state(simpleButton_State_Wait_For_Interrupt), push_time(0) {}
+
+    /**
+     * @brief       Reset the status and initialize the GPIO/EXTI/NVIC.
+     * @return      None
+     */
+    void Init(void) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN();
+
+        this->timeStamp_loop = 0;
+        this->timeStamp_interrupt = 0;
+        this->state = simpleButton_State_Wait_For_Interrupt;
+        this->push_time = 0;
+
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END();
+
+        SIMPLEBTN_FUNC_INIT_EXTI(Port, Pin, Trigger);
+    }
+
+    /**
+     * @brief       Call it in the EXTI interrupt service routine.
+     * @return      None
+     */
+    void InterruptHandler(void) {
+        if (
+            this->state == simpleButton_State_Wait_For_Interrupt
+            || this->state == simpleButton_State_Wait_For_Repeat
+        ) {
+            this->timeStamp_interrupt = SIMPLEBTN_FUNC_GET_TICK_FromISR();
+            this->state = simpleButton_State_Push_Delay;
+#if SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0
+            SIMPLEBTN_FUNC_EXTI_MASK(Pin); /* the bounce raises no more interrupt */
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0 */
+        }
+    }
+
+    /**
+     * @brief       Run the State-Machine with the tick snapshot `now`.
+     * @param[in]   now - The tick snapshot of this pass (`SIMPLEBTN_FUNC_GET_TICK()`).
+     * @return      The tick at which the handler needs to run again,
+     *              or `SIMPLEBTN__DEADLINE_NEVER` if it waits for the interrupt.
+     */
+    uint32_t HandlerAt(const uint32_t now) {
+        uint32_t deadline;
+#if SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0
+        const uint8_t state_before = this->state;
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0 */
+
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
+
+        switch (static_cast<simpleButton_Type_ButtonState_t>(this->state)) {
+        case simpleButton_State_Wait_For_Interrupt: {
+            break; /* Do nothing */
+        }
+
+        case simpleButton_State_Push_Delay: {
+            /* signed: the EXTI may stamp a tick newer than the snapshot `now` */
+            if (static_cast<int32_t>(now - this->timeStamp_interrupt) <= static_cast<int32_t>(TimingProfile::pushDelay)) {
+                break; /* still need wait */
+            }
+            if (this->IsPushed()) {
+                this->state = simpleButton_State_Wait_For_End;
+            } else {
+                this->state = (this->push_time == 0)
+                    ? simpleButton_State_Wait_For_Interrupt : simpleButton_State_Wait_For_Repeat;
+            }
+            break;
+        }
+
+        case simpleButton_State_Wait_For_End: {
+            if (!this->IsPushed()) {
+                this->timeStamp_loop = now;
+                this->state = simpleButton_State_Release_Delay;
+            } else if (now - this->timeStamp_interrupt > TimingProfile::timeout) {
+#if defined(SIMPLEBTN_DEBUG)
+                SIMPLEBTN_FUNC_PANIC("normal long push time out", , );
+#else
+                this->push_time = 0;
+                this->state = simpleButton_State_Wait_For_Interrupt;
+#endif /* defined(SIMPLEBTN_DEBUG) */
+            }
+            break;
+        }
+
+        case simpleButton_State_Release_Delay: {
+            if (now - this->timeStamp_loop <= TimingProfile::releaseDelay) {
+                break; /* still need wait */
+            }
+            if (this->IsPushed()) {
+                this->state = simpleButton_State_Wait_For_End;
+                break;
+            }
+            this->push_time ++;
+            this->timeStamp_loop = now;
+#if SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0
+            this->state = (this->push_time == 1)
+                ? simpleButton_State_Wait_For_Repeat : simpleButton_State_Repeat_Push;
+#else
+            this->state = (this->push_time < 0xFF)
+                ? simpleButton_State_Wait_For_Repeat : simpleButton_State_Repeat_Push;
+#endif /* SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0 */
+            /* no repeat push to wait for, report the single push at once */
+            if ((CallbackSet::repeatPush == nullptr || TimingProfile::repeatWindow == 0) && this->push_time == 1) {
+                this->state = simpleButton_State_Single_Push;
+            }
+            break;
+        }
+
+        case simpleButton_State_Wait_For_Repeat: {
+            SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
+            SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* begin always critical section */
+            if (now - this->timeStamp_loop > TimingProfile::repeatWindow) {
+                this->state = (this->push_time == 1)
+                    ? simpleButton_State_Single_Push : simpleButton_State_Repeat_Push;
+            }
+            SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* end always critical section */
+            SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
+            break;
+        }
+
+        case simpleButton_State_Single_Push: {
+            const uint32_t pushedFor = now - this->timeStamp_interrupt;
+            SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
+            if (pushedFor > TimingProfile::longPushMin) {
+                Button::CallLongPush(pushedFor);
+            } else {
+                Button::CallShortPush();
+            }
+            SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
+            this->EnterCoolDown(now);
+            break;
+        }
+
+        case simpleButton_State_Repeat_Push: {
+            SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
+            Button::CallRepeatPush(this->push_time);
+            SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
+            this->EnterCoolDown(now);
+            break;
+        }
+
+        case simpleButton_State_Cool_Down: {
+            if (now - this->timeStamp_loop > TimingProfile::coolDown) {
+                this->state = simpleButton_State_Wait_For_Interrupt;
+            }
+            break;
+        }
+
+        default: {
+#if defined(SIMPLEBTN_DEBUG)
+            SIMPLEBTN_FUNC_PANIC("invalid button state", , );
+#else
+            this->push_time = 0;
+            this->state = simpleButton_State_Wait_For_Interrupt;
+#endif /* defined(SIMPLEBTN_DEBUG) */
+            break;
+        }
+        } /* end switch */
+
+        deadline = this->NextDeadline(now);
+
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
+
+#if SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0
+        if (!Button::IsArmedState(state_before) && Button::IsArmedState(this->state)) {
+            deadline = this->Rearm(state_before, deadline, now);
+        }
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0 */
+
+        return deadline;
+    }
+
+    /**
+     * @brief       Run the State-Machine, call it in the while loop.
+     * @return      The same as `HandlerAt()`.
+     */
+    uint32_t Handler(void) {
+        return this->HandlerAt(SIMPLEBTN_FUNC_GET_TICK());
+    }
+
+    /**
+     * @brief       Check whether the button is idle (e.g. before low-power mode).
+     * @return      true if the button waits for the interrupt.
+     */
+    bool IsIdle(void) const {
+        return this->state == simpleButton_State_Wait_For_Interrupt;
+    }
+
+private:
+
+    uint32_t            timeStamp_loop; /* used in while loop */
+
+    volatile uint32_t   timeStamp_interrupt; /* used in interrupt */
+
+    volatile uint8_t    state; /* simpleButton_Type_ButtonState_t */
+
+    uint8_t             push_time;
+
+    bool IsPushed(void) const {
+        return SIMPLEBTN_FUNC_READ_PIN(Port, Pin) != normalPinVal;
+    }
+
+    void EnterCoolDown(const uint32_t now) {
+        this->push_time = 0;
+        this->timeStamp_loop = now;
+        this->state = simpleButton_State_Cool_Down;
+    }
+
+#if SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0
+
+    /* The EXTI line is armed only while the State-Machine waits for an edge */
+    static bool IsArmedState(const uint8_t state) {
+        return state == simpleButton_State_Wait_For_Interrupt
+            || state == simpleButton_State_Wait_For_Repeat;
+    }
+
+    /* Re-arm the line masked by `InterruptHandler()`. Leaving Push_Delay or
+       Release_Delay, the pin was just released, so a push now is a missed edge */
+    uint32_t Rearm(const uint8_t state_before, const uint32_t deadline, const uint32_t now) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN();
+
+        SIMPLEBTN_FUNC_EXTI_UNMASK(Pin); /* the stale pending flag is cleared */
+
+        if (
+            (state_before != simpleButton_State_Push_Delay && state_before != simpleButton_State_Release_Delay)
+            || !this->IsPushed()
+        ) {
+            SIMPLEBTN_FUNC_CRITICAL_SECTION_END();
+            return deadline;
+        }
+
+        this->timeStamp_interrupt = now;
+        this->state = simpleButton_State_Push_Delay;
+        SIMPLEBTN_FUNC_EXTI_MASK(Pin);
+
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END();
+
+        return now;
+    }
+
+#endif /* SIMPLEBTN_MODE_ENABLE_EXTI_MASKING != 0 */
+
+    /* Earliest tick at which the State-Machine needs to run again */
+    uint32_t NextDeadline(const uint32_t now) const {
+        uint32_t deadline;
+
+        switch (static_cast<simpleButton_Type_ButtonState_t>(this->state)) {
+        case simpleButton_State_Wait_For_Interrupt:
+            return SIMPLEBTN__DEADLINE_NEVER; /* woken up by the interrupt */
+        case simpleButton_State_Push_Delay:
+            deadline = this->timeStamp_interrupt + TimingProfile::pushDelay + 1;
+            break;
+        case simpleButton_State_Release_Delay:
+            deadline = this->timeStamp_loop + TimingProfile::releaseDelay + 1;
+            break;
+        case simpleButton_State_Wait_For_Repeat:
+            deadline = this->timeStamp_loop + TimingProfile::repeatWindow + 1;
+            break;
+        case simpleButton_State_Cool_Down:
+            deadline = this->timeStamp_loop + TimingProfile::coolDown + 1;
+            break;
+        case simpleButton_State_Wait_For_End:
+            deadline = now + SIMPLEBTN_TIME_POLL_INTERVAL; /* poll the release */
+            break;
+        default:
+            deadline = now; /* callback states, run again at once */
+            break;
+        }
+
+        /* never report a real deadline as "never" */
+        return (deadline == SIMPLEBTN__DEADLINE_NEVER) ? (deadline - 1) : deadline;
+    }
+
+    /* The callbacks are constants: a missing one costs nothing, a set one is a direct call */
+    static void CallShortPush(void) {
+        Button::Invoke(CallbackSet::shortPush);
+    }
+
+    static void CallLongPush(const uint32_t pushedFor) {
+#if SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH == 0
+        (void)pushedFor;
+        Button::Invoke(CallbackSet::longPush);
+#else
+        Button::Invoke(CallbackSet::longPush, pushedFor);
+#endif /* SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH == 0 */
+    }
+
+    static void CallRepeatPush(const uint8_t count) {
+#if SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0
+        (void)count;
+        Button::Invoke(CallbackSet::repeatPush);
+#else
+        Button::Invoke(CallbackSet::repeatPush, count);
+#endif /* SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0 */
+    }
+
+    template <class F, class... Args>
+    static void Invoke(F callBack, Args... args) {
+        if (callBack != nullptr) {
+            callBack(args...);
+        }
+    }
+};
+
+template <simpleButton_Type_GPIOBase_t P, simpleButton_Type_GPIOPin_t N, simpleButton_Type_EXTITrigger_t T, class TP, class CS>
+constexpr simpleButton_Type_GPIOBase_t Button<P, N, T, TP, CS>::port;
+template <simpleButton_Type_GPIOBase_t P, simpleButton_Type_GPIOPin_t N, simpleButton_Type_EXTITrigger_t T, class TP, class CS>
+constexpr simpleButton_Type_GPIOPin_t Button<P, N, T, TP, CS>::pin;
+template <simpleButton_Type_GPIOBase_t P, simpleButton_Type_GPIOPin_t N, simpleButton_Type_EXTITrigger_t T, class TP, class CS>
+constexpr simpleButton_Type_GPIOPinVal_t Button<P, N, T, TP, CS>::normalPinVal;
+
+} /* namespace SimpleButton */
+
+#endif /* SIMPLEBUTTON_HPP__ */
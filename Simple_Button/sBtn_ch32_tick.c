@@ -3,11 +3,15 @@
  * 
  * @author          Kim-J-Smith
  * 
- * @brief           Header file to define ch32 tick APIs.
+ * @brief           Source file to define ch32 tick APIs.
+ *                  The SysTick counter is converted to milliseconds and
+ *                  microseconds incrementally, so a tick read costs a few
+ *                  subtractions instead of a software division (RV32EC
+ *                  parts have neither a divider nor a multiplier).
  * 
- * @version         0.2.1 ( 0011L )
+ * @version         0.4.0 ( 0013L )
  * 
- * @date            2025-10-03
+ * @date            2026-10-17
  * 
  * @attention       Copyright (c) 2025 Kim-J-Smith.
  *                  All rights reserved.
@@ -28,15 +32,44 @@ extern "C" {
 #elif defined(__CC_ARM)
  #define WEAK   __weak
 #else 
- #define WEAk   
+ #define WEAK   
 #endif /* defined(__GNUC__) || defined(__clang__) */
 
 #if defined(__riscv)
 
  /* This CH32 chip may use Qingke core with RISCV Arch */
 
+ /* CH32V10x and most Qingke V4 parts have a 64-bit SysTick counter, CH32V00x has 32 bits */
+#ifndef __CH32V10x_H
+ #define SIMPLEBTN_TICK_CNT_IS_64BIT    (sizeof(SysTick->CNT) >= sizeof(uint64_t))
+#else
+ #define SIMPLEBTN_TICK_CNT_IS_64BIT    1
+#endif /* __CH32V10x_H */
+
+ /* A delta of (div << this) counts or more is converted by shift and subtract (long gap between reads) */
+ #define SIMPLEBTN_TICK_SUB_LOOP_SHIFT  3
+
+ /* Incremental converter from SysTick counts to a coarser unit */
+ typedef struct {
+
+    uint64_t    lastCount;  /* counter value of the last update */
+
+    uint32_t    remainder;  /* counts not converted yet, always < div */
+
+    uint32_t    value;      /* converted value (wraps at 2^32) */
+
+ } simpleButton_Type_TickAcc_t;
+
  /* static global variable */
- static uint32_t g_systick_div = 0;
+ static uint32_t g_systick_div = 0;         /* counts per millisecond */
+
+ static uint32_t g_systick_div_us = 0;      /* counts per microsecond */
+
+ static uint32_t g_systick_freq = 0;        /* counts per second */
+
+ static simpleButton_Type_TickAcc_t g_tick_ms;
+
+ static simpleButton_Type_TickAcc_t g_tick_us;
 
  #define SIMPLEBTN_SYSTICK_NOT_INIT 0
 
@@ -44,6 +77,89 @@ extern "C" {
 
  static uint8_t g_systick_is_init = SIMPLEBTN_SYSTICK_NOT_INIT;
 
+ /* Disable the interrupt and return the old MIE bit (mstatus.MIE = bit 3) */
+ static inline __attribute__((always_inline)) uint32_t simpleButton_Tick_IrqSave(void)
+ {
+    uint32_t mstatus;
+    __asm__ volatile ("csrrci %0, mstatus, 8" : "=r"(mstatus) : : "memory");
+    return mstatus & 8U;
+ }
+
+ /* Restore the MIE bit saved by simpleButton_Tick_IrqSave() */
+ static inline __attribute__((always_inline)) void simpleButton_Tick_IrqRestore(uint32_t mie)
+ {
+    __asm__ volatile ("csrs mstatus, %0" : : "r"(mie) : "memory");
+ }
+
+ /* Read the whole SysTick counter without tearing (high word re-checked) */
+ static inline __attribute__((always_inline)) uint64_t simpleButton_Tick_ReadCounter(void)
+ {
+#ifndef __CH32V10x_H
+    volatile uint32_t* const P_CNT = (volatile uint32_t*) &(SysTick->CNT);
+#else
+    volatile uint32_t* const P_CNT = (volatile uint32_t*) &(SysTick->CNTL0);
+#endif /* __CH32V10x_H */
+
+    uint32_t high, low;
+
+    if (!SIMPLEBTN_TICK_CNT_IS_64BIT) {
+        return (uint64_t) P_CNT[0]; /* 32-bit counter, a single load */
+    }
+
+    do {
+        high = P_CNT[1];
+        low = P_CNT[0];
+    } while (high != P_CNT[1]); /* low word wrapped between the loads */
+
+    return ((uint64_t)high << 32) | low;
+ }
+
+ /* Bring the converter up to date with the counter */
+ static inline __attribute__((always_inline)) uint32_t simpleButton_Tick_AccUpdate(
+    simpleButton_Type_TickAcc_t* const acc,
+    const uint64_t count,
+    const uint32_t div
+ ) {
+    uint64_t delta = count - acc->lastCount;
+    uint32_t remainder;
+
+    if (!SIMPLEBTN_TICK_CNT_IS_64BIT) {
+        delta = (uint32_t)delta; /* 32-bit counter wrapped */
+    }
+
+    acc->lastCount = count;
+
+    if (delta >= ((uint64_t)div << SIMPLEBTN_TICK_SUB_LOOP_SHIFT)) {
+        /* long gap: binary long division, no __udivdi3 / __umoddi3 on RV32EC */
+        uint64_t step = div;
+        uint8_t shift = 0;
+
+        while (step <= (delta >> 1)) {
+            step <<= 1;
+            shift ++;
+        }
+
+        /* value wraps at 2^32, so the units from bit 32 up are dropped */
+        do {
+            if (delta >= step) {
+                delta -= step;
+                acc->value += (shift < 32) ? ((uint32_t)1 << shift) : 0;
+            }
+            step >>= 1;
+        } while (shift-- != 0);
+    }
+
+    /* common: less than (1 << SIMPLEBTN_TICK_SUB_LOOP_SHIFT) units elapsed */
+    remainder = acc->remainder + (uint32_t)delta;
+    while (remainder >= div) {
+        remainder -= div;
+        acc->value ++;
+    }
+    acc->remainder = remainder;
+
+    return acc->value;
+ }
+
  /**
   * @brief  This function configures the source of the time base.
   * 
@@ -72,18 +188,21 @@ extern "C" {
 
     /* Init and Enable */
     SysTick->CTLR |= SysTick_Msk_Init | SysTick_Msk_Enable;
-
-    /* Init the global var */
-    g_systick_div = (SystemCoreClock / (SysTick_Msk_STCLK ? (8000) : (1000)));
 #else
     /* SysTick configure */
     const uint32_t SysTick_Msk_Enable_with_8Div = (uint32_t)(1U << 0);
     SysTick->CTLR |= SysTick_Msk_Enable_with_8Div;
-
-    /* Init the global var */
-    g_systick_div = SystemCoreClock / 8000;
 #endif /* __CH32V10x_H */
 
+    /* Init the global var (the only divisions, done once) */
+    g_systick_freq = SystemCoreClock / 8;
+    g_systick_div = g_systick_freq / 1000;
+    g_systick_div_us = (g_systick_freq >= 1000000) ? (g_systick_freq / 1000000) : 1;
+
+    g_tick_ms.lastCount = g_tick_us.lastCount = simpleButton_Tick_ReadCounter();
+    g_tick_ms.remainder = g_tick_us.remainder = 0;
+    g_tick_ms.value = g_tick_us.value = 0;
+
     /* global var */
     g_systick_is_init = SIMPLEBTN_SYSTICK_IS_INIT;
  }
@@ -93,17 +212,74 @@ extern "C" {
   * 
   * @note   The function is declared as WEAK to be overwritten  in case of other
   *         implementation  in user file.
+  *         The value wraps to 0 after 2^32 ms (about 49.7 days). Compare ticks
+  *         by unsigned subtraction (`now - start >= time`), as Simple-Button
+  *         does, and the wraparound is harmless.
+  *         It can be called in interrupts.
   * 
   * @return tick value.
   */
  WEAK uint32_t HAL_GetTick(void)
  {
-#ifndef __CH32V10x_H
-    return (uint32_t) (SysTick->CNT / g_systick_div);
-#else
-    volatile uint64_t* P_CNT = (uint64_t*) &(SysTick->CNTL0);
-    return (uint32_t) ( (*P_CNT) / g_systick_div);
-#endif /* __CH32V10x_H */
+    uint32_t mie, tick;
+
+    if (g_systick_is_init != SIMPLEBTN_SYSTICK_IS_INIT) {
+        return 0; /* HAL_InitTick() is not called yet */
+    }
+
+    mie = simpleButton_Tick_IrqSave();
+    tick = simpleButton_Tick_AccUpdate(&g_tick_ms, simpleButton_Tick_ReadCounter(), g_systick_div);
+    simpleButton_Tick_IrqRestore(mie);
+
+    return tick;
+ }
+
+ /**
+  * @brief  Provides a tick value in microsecond.
+  * 
+  * @note   The value wraps to 0 after 2^32 us (about 71.6 minutes), compare
+  *         by unsigned subtraction. The resolution is 1 us only if the SysTick
+  *         clock (HCLK/8) is a multiple of 1 MHz.
+  * 
+  * @return tick value in microsecond.
+  */
+ WEAK uint32_t HAL_GetTickUs(void)
+ {
+    uint32_t mie, tick;
+
+    if (g_systick_is_init != SIMPLEBTN_SYSTICK_IS_INIT) {
+        return 0; /* HAL_InitTick() is not called yet */
+    }
+
+    mie = simpleButton_Tick_IrqSave();
+    tick = simpleButton_Tick_AccUpdate(&g_tick_us, simpleButton_Tick_ReadCounter(), g_systick_div_us);
+    simpleButton_Tick_IrqRestore(mie);
+
+    return tick;
+ }
+
+ /**
+  * @brief  Provides the raw SysTick counter (HCLK/8 resolution).
+  * 
+  * @note   The 64-bit counter is read atomically, it does not wrap in practice.
+  *         On parts with a 32-bit counter, it wraps after 2^32 counts, so the
+  *         tick must be read at least once per counter period (e.g. 715 s at
+  *         48 MHz HCLK) for HAL_GetTick() to stay exact.
+  * 
+  * @return counter value, see HAL_GetCounterFreq() for its frequency.
+  */
+ WEAK uint64_t HAL_GetCounter(void)
+ {
+    return simpleButton_Tick_ReadCounter();
+ }
+
+ /**
+  * @brief  Provides the frequency of HAL_GetCounter().
+  * @return counts per second.
+  */
+ WEAK uint32_t HAL_GetCounterFreq(void)
+ {
+    return g_systick_freq;
  }
 
  WEAK void HAL_Delay(uint32_t Delay)
@@ -112,6 +288,38 @@ extern "C" {
     while (HAL_GetTick() - current < Delay);
  }
 
+ /**
+  * @brief  Advance the tick by the time spent with SysTick stopped.
+  * 
+  * @note   SysTick does not count in STOP/STANDBY mode. Call this function
+  *         after waking up with the time measured by a clock that keeps
+  *         running (e.g. the RTC), so that HAL_GetTick() and HAL_GetTickUs()
+  *         stay correct. The counts not converted yet are kept.
+  *         The function is declared as WEAK to be overwritten  in case of other
+  *         implementation  in user file.
+  * 
+  * @param  Ms - The slept time in millisecond.
+  * 
+  * @return None
+  */
+ WEAK void HAL_AdvanceTick(uint32_t Ms)
+ {
+    uint32_t mie;
+    uint64_t count;
+
+    if (g_systick_is_init != SIMPLEBTN_SYSTICK_IS_INIT) {
+        return; /* HAL_InitTick() is not called yet */
+    }
+
+    mie = simpleButton_Tick_IrqSave();
+    count = simpleButton_Tick_ReadCounter();
+    (void) simpleButton_Tick_AccUpdate(&g_tick_ms, count, g_systick_div);
+    (void) simpleButton_Tick_AccUpdate(&g_tick_us, count, g_systick_div_us);
+    g_tick_ms.value += Ms;
+    g_tick_us.value += Ms * 1000U;
+    simpleButton_Tick_IrqRestore(mie);
+ }
+
 #endif /* defined(__riscv) */
 
 
@@ -5,9 +5,9 @@
  * 
  * @brief           Header file to declare ch32 tick APIs.
  * 
- * @version         0.2.1 ( 0011L )
+ * @version         0.4.0 ( 0013L )
  * 
- * @date            2025-10-03
+ * @date            2026-10-17
  * 
  * @attention       Copyright (c) 2025 Kim-J-Smith.
  *                  All rights reserved.
@@ -17,7 +17,7 @@
  *                  <https://github.com/Kim-J-Smith/CH32-SimpleButton>
  */
 #ifndef     SIMPLEBUTTON_CH32_TICK_H__
-#define     SIMPLEBUTTON_CH32_TICK_H__      0011L
+#define     SIMPLEBUTTON_CH32_TICK_H__      0013L
 
 #include    <stdint.h>
 #include    "debug.h"
@@ -31,7 +31,11 @@ extern "C" {
 
 void HAL_InitTick(void);
 uint32_t HAL_GetTick(void);
+uint32_t HAL_GetTickUs(void);
+uint64_t HAL_GetCounter(void);
+uint32_t HAL_GetCounterFreq(void);
 void HAL_Delay(uint32_t Delay);
+void HAL_AdvanceTick(uint32_t Ms);
 
 #ifdef __cplusplus
 }
@@ -74,6 +74,27 @@ typedef EXTITrigger_TypeDef simpleButton_Type_EXTITrigger_t;
 #define SIMPLEBTN_FUNC_READ_PIN(GPIOX_Base, Pin) \
     GPIO_ReadInputDataBit((GPIO_TypeDef*)GPIOX_Base, Pin)
 
+#define SIMPLEBTN_FUNC_READ_PORT(GPIOX_Base) \
+    ((uint32_t)(((GPIO_TypeDef*)(GPIOX_Base))->INDR)) /* used in port-sampling mode */
+
+#define SIMPLEBTN_FUNC_WRITE_PORT(GPIOX_Base, SetPins, ResetPins) \
+    do { ((GPIO_TypeDef*)(GPIOX_Base))->BSHR = ((uint32_t)(ResetPins) << 16) | (uint32_t)(SetPins); } while (0) /* used in matrix mode */
+
+#define SIMPLEBTN_FUNC_MATRIX_SETTLE() \
+    do { __NOP(); __NOP(); __NOP(); __NOP(); } while (0) /* used in matrix mode, the columns follow the new row */
+
+#define SIMPLEBTN_FUNC_EXTI_GET_PENDING() \
+    ((uint32_t)(EXTI->INTFR)) /* used in exti-dispatch mode */
+
+#define SIMPLEBTN_FUNC_EXTI_CLEAR_PENDING(EXTI_Lines) \
+    do { EXTI->INTFR = (uint32_t)(EXTI_Lines); } while (0) /* used in exti-dispatch mode */
+
+#define SIMPLEBTN_FUNC_EXTI_MASK(EXTI_Lines) \
+    do { EXTI->INTENR &= ~(uint32_t)(EXTI_Lines); } while (0) /* used in exti-masking mode */
+
+#define SIMPLEBTN_FUNC_EXTI_UNMASK(EXTI_Lines) \
+    do { EXTI->INTFR = (uint32_t)(EXTI_Lines); EXTI->INTENR |= (uint32_t)(EXTI_Lines); } while (0) /* used in exti-masking mode */
+
 #define SIMPLEBTN_FUNC_GET_TICK() \
     HAL_GetTick() // or xTaskGetTickCount() if you use FreeRTOS
 
@@ -92,6 +113,15 @@ typedef EXTITrigger_TypeDef simpleButton_Type_EXTITrigger_t;
 #define SIMPLEBTN_FUNC_START_LOW_POWER() \
     simpleButton_start_low_power()
 
+#define SIMPLEBTN_FUNC_START_DEEP_SLEEP() \
+    simpleButton_start_deep_sleep() /* used in deep-sleep mode */
+
+#define SIMPLEBTN_FUNC_ADVANCE_TICK(Ms) \
+    HAL_AdvanceTick(Ms) // or vTaskStepTick(Ms) if you use FreeRTOS (used in deep-sleep mode)
+
+#define SIMPLEBTN_FUNC_GET_CYCLE() \
+    simpleButton_get_cycle() /* used in profiling mode */
+
 /** @b ================================================================ **/
 /** @b Time-Set */
 
@@ -113,6 +143,16 @@ typedef EXTITrigger_TypeDef simpleButton_Type_EXTITrigger_t;
 #define SIMPLEBTN_TIME__TIMEOUT_NORMAL                  (1000 * 120)
     // The timeout time for combination long button.
 #define SIMPLEBTN_TIME__TIMEOUT_COMBINATION             (1000 * 240)
+    // The sampling interval of the vertical debounce. (4 stable samples are needed)
+#define SIMPLEBTN_TIME_VERTICAL_SAMPLE                  5
+    // The poll interval reported as next deadline while the release (or a dynamic push) is awaited.
+#define SIMPLEBTN_TIME_POLL_INTERVAL                    10
+    // The sampling interval of the integrating debounce of a dynamic-button (the least time between two samples).
+#define SIMPLEBTN_TIME_INTEGRATE_INTERVAL               2
+    // The scan interval of a key matrix while one of its keys is busy.
+#define SIMPLEBTN_TIME_MATRIX_SCAN                      5
+    // The interval of the sample batches of a resistor ladder while one of its keys is busy.
+#define SIMPLEBTN_TIME_LADDER_SCAN                      5
 
 /** @b ================================================================ **/
 /** @b Mode-Set */
@@ -131,6 +171,64 @@ typedef EXTITrigger_TypeDef simpleButton_Type_EXTITrigger_t;
 #define SIMPLEBTN_MODE_ENABLE_MULTI_THREADS             0
     // Enable long-push-hold mode if this macro is defined as 1.
 #define SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD             0
+    // Enable button registry (SimpleButton_ProcessAll) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_REGISTRY                  0
+    // The maximum number of buttons in the registry. (1 ~ 254)
+#define SIMPLEBTN_REGISTRY_CAPACITY                     32
+    // Enable port-sampling (read each GPIO port of the registry once per pass) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING             0
+    // The maximum number of different GPIO ports in the registry.
+#define SIMPLEBTN_REGISTRY_PORT_CAPACITY                5
+    // Enable vertical-counter debounce of the port snapshots if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE         0
+    // Enable event queue (registry buttons report events instead of calling back) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE               0
+    // The number of slots in the event queue. (power of 2, 2 ~ 128, one slot is kept empty)
+#define SIMPLEBTN_EVENT_QUEUE_SIZE                      16
+    // Enable compact button state (16-bit time stamps, 6 bytes of private status per button) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_COMPACT_STATE             0
+    // Enable button table (X-macro list, one shared handler and interrupt entry) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_BUTTON_TABLE              0
+    // Enable the shared EXTI dispatcher (reads the pending flags once per interrupt) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH             0
+    // Enable the deadline heap (SimpleButton_ProcessAll only runs the registry buttons whose deadline expired) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP             0
+    // Enable deep-sleep mode (SIMPLEBTN__START_LOWPOWER enters STOP instead of SLEEP, the slept time is measured by the RTC, not on CH32V003) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_DEEP_SLEEP                0
+    // Enable EXTI masking (the EXTI line is masked from the accepted edge until the button waits for an edge again) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_EXTI_MASKING              0
+    // Enable profiling (cycle statistics of the interrupt, the states and the callbacks) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_PROFILING                 0
+    // The number of log2 histogram bins of the profiling statistics. (1 ~ 32, bin n counts 2^n ~ 2^(n+1)-1 cycles)
+#define SIMPLEBTN_PROFILE_HIST_BINS                     16
+    // Enable the trace recorder (state transitions, EXTI hits and callbacks in a RAM ring buffer) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_TRACE                     0
+    // The number of records in the trace ring buffer. (power of 2, 2 ~ 32768, 6 bytes per record)
+#define SIMPLEBTN_TRACE_SIZE                            256
+    // Enable press / release events (called when the push and the release are debounced) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_PRESS_EVENT               0
+    // Enable adaptive debounce (each button tunes its push / release delay to the bounce it measures) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE         0
+    // The bounds of the adaptive debounce window, and the margin kept above the measured bounce. (ticks, 1 <= MIN <= MAX <= 255)
+#define SIMPLEBTN_DEBOUNCE_MIN                          5
+#define SIMPLEBTN_DEBOUNCE_MAX                          30
+#define SIMPLEBTN_DEBOUNCE_MARGIN                       3
+    // Enable integrating debounce (dynamic-buttons follow the pin after N agreeing samples) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE      0
+    // The agreeing samples in a row needed to change the level of a dynamic-button. (1 ~ 127)
+#define SIMPLEBTN_INTEGRATE_SAMPLES                     4
+    // Enable key matrix mode (rows driven and columns read port-wide, one State-Machine per key) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_MATRIX                    0
+    // Enable resistor ladder mode (several keys on one ADC pin, sampled by scan + DMA, one State-Machine per key) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_LADDER                    0
+    // The conversion rounds of all ladder channels kept in the DMA buffer, averaged as one batch. (1 ~ 64)
+#define SIMPLEBTN_LADDER_BATCH                          8
+    // The ADC counts a new band must be closer than the current one before the key changes.
+#define SIMPLEBTN_LADDER_HYSTERESIS                     48
+    // A batch whose samples spread more than this (ADC counts) is moving and ignored.
+#define SIMPLEBTN_LADDER_SPREAD                         128
+    // The ADC value of a ladder channel with no key pushed (the pull-up).
+#define SIMPLEBTN_LADDER_RELEASED                       4095
 
 /** @b ================================================================ **/
 /** @b Namespace */
@@ -150,6 +248,26 @@ typedef EXTITrigger_TypeDef simpleButton_Type_EXTITrigger_t;
 #define SIMPLEBTN_FUNC_INIT_EXTI(GPIOX_Base, GPIO_Pin_X, EXTI_Trigger_X) \
     simpleButton_Private_InitEXTI(GPIOX_Base, GPIO_Pin_X, EXTI_Trigger_X)
 
+/* Init all the pins of one port at once (optional, used by `SimpleButton_Table_Init`) */
+#define SIMPLEBTN_FUNC_INIT_EXTI_PORT(GPIOX_Base, Pins_Falling, Pins_Rising) \
+    simpleButton_Private_InitEXTIPort(GPIOX_Base, Pins_Falling, Pins_Rising)
+
+/* Enable the NVIC channels of some EXTI lines at once (optional, used by `SimpleButton_Table_Init`) */
+#define SIMPLEBTN_FUNC_INIT_EXTI_NVIC(EXTI_Lines) \
+    simpleButton_Private_InitEXTINVIC(EXTI_Lines)
+
+/* Init the rows (open-drain outputs, released) and the columns (pull-up inputs) of a key matrix */
+#define SIMPLEBTN_FUNC_INIT_MATRIX(Row_Base, Row_Pins, Col_Base, Col_Pins) \
+    simpleButton_Private_InitMatrix(Row_Base, Row_Pins, Col_Base, Col_Pins)
+
+/* Init the analog pin of one resistor ladder channel as the regular conversion `Rank` (0-based) */
+#define SIMPLEBTN_FUNC_INIT_LADDER_CHANNEL(GPIOX_Base, GPIO_Pin_X, ADC_Channel, Rank) \
+    simpleButton_Private_InitLadderChannel(GPIOX_Base, GPIO_Pin_X, ADC_Channel, Rank)
+
+/* Start converting all ladder channels again and again, written by DMA into a circular buffer */
+#define SIMPLEBTN_FUNC_INIT_LADDER_ADC(ChannelNum, Samples, SampleNum) \
+    simpleButton_Private_InitLadderADC(ChannelNum, Samples, SampleNum)
+
 
 /** @b ================================================================ **/
 /** @b NVIC-EXTI-Priority */
@@ -180,114 +298,124 @@ static inline void simpleButton_debug_panic(const char* cause)
     while(1);
 }
 
-// Init the EXTI
+// Get the port source and the clock of a GPIO port
 SIMPLEBTN_FORCE_INLINE
-void simpleButton_Private_InitEXTI(
+void simpleButton_Private_PortSource(
     simpleButton_Type_GPIOBase_t    GPIOX_Base,
-    simpleButton_Type_GPIOPin_t     GPIO_Pin_X,
-    simpleButton_Type_EXTITrigger_t EXTI_Trigger_X
+    uint8_t*                        PortSource,
+    uint32_t*                       RCC_GPIOX
 ) {
-
-    /* Initialize the GPIOx Clock */
-    GPIO_InitTypeDef gpio_config;
-    EXTI_InitTypeDef exti_config;    
-    NVIC_InitTypeDef nvic_config;
-    uint8_t PortSource;         
-    uint8_t PinSource;          
-    uint32_t EXTI_Line;
-    uint32_t RCC_GPIOX;
-                
-    /* static constexpr assign values to variables */
     switch(GPIOX_Base)
     {
 #if defined(GPIOA_BASE) && defined(RCC_APB2Periph_GPIOA)
     case GPIOA_BASE:
-        PortSource = GPIO_PortSourceGPIOA;
-        RCC_GPIOX = RCC_APB2Periph_GPIOA;
+        *PortSource = GPIO_PortSourceGPIOA;
+        *RCC_GPIOX = RCC_APB2Periph_GPIOA;
         break;
 #endif /* defined(GPIOA) */
 #if defined(GPIOB_BASE) && defined(RCC_APB2Periph_GPIOB)
     case GPIOB_BASE:
-        PortSource = GPIO_PortSourceGPIOB;
-        RCC_GPIOX = RCC_APB2Periph_GPIOB;
+        *PortSource = GPIO_PortSourceGPIOB;
+        *RCC_GPIOX = RCC_APB2Periph_GPIOB;
         break;
 #endif /* defined(GPIOB) */
 #if defined(GPIOC_BASE) && defined(RCC_APB2Periph_GPIOC)
     case GPIOC_BASE:
-        PortSource = GPIO_PortSourceGPIOC;
-        RCC_GPIOX = RCC_APB2Periph_GPIOC;
+        *PortSource = GPIO_PortSourceGPIOC;
+        *RCC_GPIOX = RCC_APB2Periph_GPIOC;
         break;
 #endif /* defined(GPIOC) */
 #if defined(GPIOD_BASE) && defined(RCC_APB2Periph_GPIOD)
     case GPIOD_BASE:
-        PortSource = GPIO_PortSourceGPIOD;
-        RCC_GPIOX = RCC_APB2Periph_GPIOD;
+        *PortSource = GPIO_PortSourceGPIOD;
+        *RCC_GPIOX = RCC_APB2Periph_GPIOD;
         break;
 #endif /* defined(GPIOD) */
 #if defined(GPIOE_BASE) && defined(RCC_APB2Periph_GPIOE)
     case GPIOE_BASE:
-        PortSource = GPIO_PortSourceGPIOE;
-        RCC_GPIOX = RCC_APB2Periph_GPIOE;
+        *PortSource = GPIO_PortSourceGPIOE;
+        *RCC_GPIOX = RCC_APB2Periph_GPIOE;
         break;
 #endif /* defined(GPIOE) */
 #if defined(GPIOF_BASE) && defined(RCC_APB2Periph_GPIOF)
     case GPIOF_BASE:
-        PortSource = GPIO_PortSourceGPIOF;
-        RCC_GPIOX = RCC_APB2Periph_GPIOF;
+        *PortSource = GPIO_PortSourceGPIOF;
+        *RCC_GPIOX = RCC_APB2Periph_GPIOF;
         break;
 #endif /* defined(GPIOF_BASE) */
 #if defined(GPIOG_BASE) && defined(RCC_APB2Periph_GPIOG)
     case GPIOG_BASE:
-        PortSource = GPIO_PortSourceGPIOG;
-        RCC_GPIOX = RCC_APB2Periph_GPIOG;
+        *PortSource = GPIO_PortSourceGPIOG;
+        *RCC_GPIOX = RCC_APB2Periph_GPIOG;
         break;
 #endif /* defined(GPIOG_BASE) */
 #if defined(GPIOH_BASE) && defined(RCC_APB2Periph_GPIOH)
     case GPIOH_BASE:
-        PortSource = GPIO_PortSourceGPIOH;
-        RCC_GPIOX = RCC_APB2Periph_GPIOH;
+        *PortSource = GPIO_PortSourceGPIOH;
+        *RCC_GPIOX = RCC_APB2Periph_GPIOH;
         break;
 #endif /* defined(GPIOH_BASE) */
 #if defined(GPIOI_BASE) && defined(RCC_APB2Periph_GPIOI)
     case GPIOI_BASE:
-        PortSource = GPIO_PortSourceGPIOI;
-        RCC_GPIOX = RCC_APB2Periph_GPIOI;
+        *PortSource = GPIO_PortSourceGPIOI;
+        *RCC_GPIOX = RCC_APB2Periph_GPIOI;
         break;
 #endif /* defined(GPIOI_BASE) */
 #if defined(GPIOJ_BASE) && defined(RCC_APB2Periph_GPIOJ)
     case GPIOJ_BASE:
-        PortSource = GPIO_PortSourceGPIOJ;
-        RCC_GPIOX = RCC_APB2Periph_GPIOJ;
+        *PortSource = GPIO_PortSourceGPIOJ;
+        *RCC_GPIOX = RCC_APB2Periph_GPIOJ;
         break;
 #endif /* defined(GPIOJ_BASE) */
 #if defined(GPIOK_BASE) && defined(RCC_APB2Periph_GPIOK)
     case GPIOK_BASE:
-        PortSource = GPIO_PortSourceGPIOK;
-        RCC_GPIOX = RCC_APB2Periph_GPIOK;
+        *PortSource = GPIO_PortSourceGPIOK;
+        *RCC_GPIOX = RCC_APB2Periph_GPIOK;
         break;
 #endif /* defined(GPIOK_BASE) */
 #if defined(GPIOL_BASE) && defined(RCC_APB2Periph_GPIOL)
     case GPIOL_BASE:
-        PortSource = GPIO_PortSourceGPIOL;
-        RCC_GPIOX = RCC_APB2Periph_GPIOL;
+        *PortSource = GPIO_PortSourceGPIOL;
+        *RCC_GPIOX = RCC_APB2Periph_GPIOL;
         break;
 #endif /* defined(GPIOL_BASE) */
 #if defined(GPIOM_BASE) && defined(RCC_APB2Periph_GPIOM)
     case GPIOM_BASE:
-        PortSource = GPIO_PortSourceGPIOM;
-        RCC_GPIOX = RCC_APB2Periph_GPIOM;
+        *PortSource = GPIO_PortSourceGPIOM;
+        *RCC_GPIOX = RCC_APB2Periph_GPIOM;
         break;
 #endif /* defined(GPIOM_BASE) */
 #if defined(GPION_BASE) && defined(RCC_APB2Periph_GPION)
     case GPION_BASE:
-        PortSource = GPIO_PortSourceGPION;
-        RCC_GPIOX = RCC_APB2Periph_GPION;
+        *PortSource = GPIO_PortSourceGPION;
+        *RCC_GPIOX = RCC_APB2Periph_GPION;
         break;
 #endif /* defined(GPION_BASE) */
     default:
         SIMPLEBTN_FUNC_PANIC("unexpected GPIO port", , );
         break;
     }
+}
+
+// Init the EXTI
+SIMPLEBTN_FORCE_INLINE
+void simpleButton_Private_InitEXTI(
+    simpleButton_Type_GPIOBase_t    GPIOX_Base,
+    simpleButton_Type_GPIOPin_t     GPIO_Pin_X,
+    simpleButton_Type_EXTITrigger_t EXTI_Trigger_X
+) {
+
+    /* Initialize the GPIOx Clock */
+    GPIO_InitTypeDef gpio_config;
+    EXTI_InitTypeDef exti_config;    
+    NVIC_InitTypeDef nvic_config;
+    uint8_t PortSource;         
+    uint8_t PinSource;          
+    uint32_t EXTI_Line;
+    uint32_t RCC_GPIOX;
+                
+    /* static constexpr assign values to variables */
+    simpleButton_Private_PortSource(GPIOX_Base, &PortSource, &RCC_GPIOX);
 
     switch(GPIO_Pin_X)
     {
@@ -446,6 +574,190 @@ void simpleButton_Private_InitEXTI(
     NVIC_Init(&nvic_config);
 }
 
+// Init the GPIO and EXTI of several pins of one port, the port clock is enabled once
+static inline void simpleButton_Private_InitEXTIPort(
+    simpleButton_Type_GPIOBase_t    GPIOX_Base,
+    simpleButton_Type_GPIOPin_t     Pins_Falling,
+    simpleButton_Type_GPIOPin_t     Pins_Rising
+) {
+    GPIO_InitTypeDef gpio_config;
+    EXTI_InitTypeDef exti_config;
+    uint8_t PortSource;
+    uint8_t PinSource;
+    uint32_t RCC_GPIOX;
+
+    simpleButton_Private_PortSource(GPIOX_Base, &PortSource, &RCC_GPIOX);
+
+    /* GPIO & AFIO Init */
+    RCC_APB2PeriphClockCmd(RCC_GPIOX | RCC_APB2Periph_AFIO, ENABLE);
+
+    gpio_config.GPIO_Speed  = GPIO_Speed_2MHz;
+    exti_config.EXTI_Mode = EXTI_Mode_Interrupt;
+    exti_config.EXTI_LineCmd = ENABLE;
+
+    /* GPIO_PinSourceN is N, EXTI_LineN and GPIO_Pin_N are both (1 << N) */
+    for (PinSource = 0; PinSource < 16; PinSource++) {
+        if ((((uint32_t)Pins_Falling | Pins_Rising) >> PinSource) & 1U) {
+            GPIO_EXTILineConfig(PortSource, PinSource);
+        }
+    }
+
+    if (Pins_Falling != 0) {
+        gpio_config.GPIO_Pin    = Pins_Falling;
+        gpio_config.GPIO_Mode   = GPIO_Mode_IPU;
+        GPIO_Init((GPIO_TypeDef*)GPIOX_Base, &gpio_config);
+
+        exti_config.EXTI_Line = Pins_Falling;
+        exti_config.EXTI_Trigger = EXTI_Trigger_Falling;
+        EXTI_Init(&exti_config);
+    }
+
+    if (Pins_Rising != 0) {
+        gpio_config.GPIO_Pin    = Pins_Rising;
+        gpio_config.GPIO_Mode   = GPIO_Mode_IPD;
+        GPIO_Init((GPIO_TypeDef*)GPIOX_Base, &gpio_config);
+
+        exti_config.EXTI_Line = Pins_Rising;
+        exti_config.EXTI_Trigger = EXTI_Trigger_Rising;
+        EXTI_Init(&exti_config);
+    }
+}
+
+// Init the pins of a key matrix
+static inline void simpleButton_Private_InitMatrix(
+    simpleButton_Type_GPIOBase_t    Row_Base,
+    simpleButton_Type_GPIOPin_t     Row_Pins,
+    simpleButton_Type_GPIOBase_t    Col_Base,
+    simpleButton_Type_GPIOPin_t     Col_Pins
+) {
+    GPIO_InitTypeDef gpio_config;
+    uint8_t PortSource;
+    uint32_t RCC_Row, RCC_Col;
+
+    simpleButton_Private_PortSource(Row_Base, &PortSource, &RCC_Row);
+    simpleButton_Private_PortSource(Col_Base, &PortSource, &RCC_Col);
+    RCC_APB2PeriphClockCmd(RCC_Row | RCC_Col, ENABLE);
+
+    /* released rows first, so no key is read while the pins change mode */
+    ((GPIO_TypeDef*)Row_Base)->BSHR = Row_Pins;
+
+    gpio_config.GPIO_Speed  = GPIO_Speed_2MHz;
+    gpio_config.GPIO_Pin    = Row_Pins;
+    gpio_config.GPIO_Mode   = GPIO_Mode_Out_OD;
+    GPIO_Init((GPIO_TypeDef*)Row_Base, &gpio_config);
+
+    gpio_config.GPIO_Pin    = Col_Pins;
+    gpio_config.GPIO_Mode   = GPIO_Mode_IPU;
+    GPIO_Init((GPIO_TypeDef*)Col_Base, &gpio_config);
+}
+
+// Init one channel of a resistor ladder: analog input, regular conversion `Rank` of ADC1
+static inline void simpleButton_Private_InitLadderChannel(
+    simpleButton_Type_GPIOBase_t    GPIOX_Base,
+    simpleButton_Type_GPIOPin_t     GPIO_Pin_X,
+    uint8_t                         ADC_Channel,
+    uint8_t                         Rank
+) {
+    GPIO_InitTypeDef gpio_config;
+    uint8_t PortSource;
+    uint32_t RCC_GPIOX;
+
+    simpleButton_Private_PortSource(GPIOX_Base, &PortSource, &RCC_GPIOX);
+    RCC_APB2PeriphClockCmd(RCC_GPIOX | RCC_APB2Periph_ADC1, ENABLE);
+
+    gpio_config.GPIO_Pin    = GPIO_Pin_X;
+    gpio_config.GPIO_Mode   = GPIO_Mode_AIN;
+    GPIO_Init((GPIO_TypeDef*)GPIOX_Base, &gpio_config);
+
+#if defined(__CH32V00x_H) // CH32V003
+    ADC_RegularChannelConfig(ADC1, ADC_Channel, (uint8_t)(Rank + 1), ADC_SampleTime_241Cycles);
+#else
+    ADC_RegularChannelConfig(ADC1, ADC_Channel, (uint8_t)(Rank + 1), ADC_SampleTime_239Cycles5);
+#endif
+}
+
+// Start ADC1 in continuous scan mode, DMA1 channel 1 writes the results into a circular buffer.
+// The CPU is not involved per conversion, it reads the buffer as a batch.
+static inline void simpleButton_Private_InitLadderADC(uint8_t ChannelNum, volatile uint16_t* Samples, uint16_t SampleNum)
+{
+    ADC_InitTypeDef adc_config;
+    DMA_InitTypeDef dma_config;
+
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+    RCC_ADCCLKConfig(RCC_PCLK2_Div8);
+
+    DMA_DeInit(DMA1_Channel1);
+    dma_config.DMA_PeripheralBaseAddr   = (uint32_t)&(ADC1->RDATAR);
+    dma_config.DMA_MemoryBaseAddr       = (uint32_t)Samples;
+    dma_config.DMA_DIR                  = DMA_DIR_PeripheralSRC;
+    dma_config.DMA_BufferSize           = SampleNum;
+    dma_config.DMA_PeripheralInc        = DMA_PeripheralInc_Disable;
+    dma_config.DMA_MemoryInc            = DMA_MemoryInc_Enable;
+    dma_config.DMA_PeripheralDataSize   = DMA_PeripheralDataSize_HalfWord;
+    dma_config.DMA_MemoryDataSize       = DMA_MemoryDataSize_HalfWord;
+    dma_config.DMA_Mode                 = DMA_Mode_Circular;
+    dma_config.DMA_Priority             = DMA_Priority_Low;
+    dma_config.DMA_M2M                  = DMA_M2M_Disable;
+    DMA_Init(DMA1_Channel1, &dma_config);
+    DMA_Cmd(DMA1_Channel1, ENABLE);
+
+    /* the channels were already given their ranks, `ADC_Init` only sets the length */
+    adc_config.ADC_Mode                 = ADC_Mode_Independent;
+    adc_config.ADC_ScanConvMode         = ENABLE;
+    adc_config.ADC_ContinuousConvMode   = ENABLE;
+    adc_config.ADC_ExternalTrigConv     = ADC_ExternalTrigConv_None;
+    adc_config.ADC_DataAlign            = ADC_DataAlign_Right;
+    adc_config.ADC_NbrOfChannel         = ChannelNum;
+    ADC_Init(ADC1, &adc_config);
+
+    ADC_DMACmd(ADC1, ENABLE);
+    ADC_Cmd(ADC1, ENABLE);
+
+    ADC_ResetCalibration(ADC1);
+    while (ADC_GetResetCalibrationStatus(ADC1) != RESET);
+    ADC_StartCalibration(ADC1);
+    while (ADC_GetCalibrationStatus(ADC1) != RESET);
+
+    ADC_SoftwareStartConvCmd(ADC1, ENABLE);
+}
+
+// Enable the NVIC channels of several EXTI lines, each channel once
+static inline void simpleButton_Private_InitEXTINVIC(uint32_t EXTI_Lines)
+{
+    NVIC_InitTypeDef nvic_config;
+
+    nvic_config.NVIC_IRQChannelPreemptionPriority = SIMPLEBTN_NVIC_EXTI_PreemptionPriority;
+    nvic_config.NVIC_IRQChannelSubPriority = SIMPLEBTN_NVIC_EXTI_SubPriority;
+    nvic_config.NVIC_IRQChannelCmd = ENABLE;
+
+#if defined(__CH32V00x_H) // CH32V003
+    if ((EXTI_Lines & 0x00FFU) != 0) {
+        nvic_config.NVIC_IRQChannel = EXTI7_0_IRQn;
+        NVIC_Init(&nvic_config);
+    }
+#else
+    static const uint8_t exti_irqn[5] = {
+        EXTI0_IRQn, EXTI1_IRQn, EXTI2_IRQn, EXTI3_IRQn, EXTI4_IRQn
+    };
+    uint8_t line;
+
+    for (line = 0; line < 5; line++) {
+        if ((EXTI_Lines >> line) & 1U) {
+            nvic_config.NVIC_IRQChannel = exti_irqn[line];
+            NVIC_Init(&nvic_config);
+        }
+    }
+    if ((EXTI_Lines & 0x03E0U) != 0) {
+        nvic_config.NVIC_IRQChannel = EXTI9_5_IRQn;
+        NVIC_Init(&nvic_config);
+    }
+    if ((EXTI_Lines & 0xFC00U) != 0) {
+        nvic_config.NVIC_IRQChannel = EXTI15_10_IRQn;
+        NVIC_Init(&nvic_config);
+    }
+#endif
+}
+
 // Start the low-power mode. (SLEEP)
 SIMPLEBTN_FORCE_INLINE void simpleButton_start_low_power(void)
 {
@@ -463,6 +775,81 @@ SIMPLEBTN_FORCE_INLINE void simpleButton_start_low_power(void)
     __NOP();
 }
 
+// Start the RTC as the deep-sleep clock, unless it already runs.
+SIMPLEBTN_FORCE_INLINE void simpleButton_deep_sleep_clock_init(void)
+{
+#if !defined(__CH32V00x_H) // CH32V003 has no RTC
+    if ((RCC->BDCTLR & RCC_RTCEN) != 0) {
+        return; /* configured by the user, it must count once per millisecond */
+    }
+
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR | RCC_APB1Periph_BKP, ENABLE);
+    PWR_BackupAccessCmd(ENABLE);
+
+    RCC_LSICmd(ENABLE);
+    while (RCC_GetFlagStatus(RCC_FLAG_LSIRDY) == RESET);
+
+    RCC_RTCCLKConfig(RCC_RTCCLKSource_LSI);
+    RCC_RTCCLKCmd(ENABLE);
+    RTC_WaitForSynchro();
+    RTC_WaitForLastTask();
+
+    /* LSI (about 40 kHz, RC) counts about once per millisecond */
+    RTC_SetPrescaler(40 - 1);
+    RTC_WaitForLastTask();
+#endif
+}
+
+// The clock that keeps running in deep sleep, in milliseconds.
+SIMPLEBTN_FORCE_INLINE uint32_t simpleButton_deep_sleep_clock(void)
+{
+#if defined(__CH32V00x_H) // CH32V003
+    /* No RTC, the tick is not advanced by the slept time */
+    return 0;
+#else
+    return RTC_GetCounter();
+#endif
+}
+
+// Start the deep low-power mode. (STOP, or STANDBY on CH32V003)
+SIMPLEBTN_FORCE_INLINE void simpleButton_start_deep_sleep(void)
+{
+    /* The same as simpleButton_start_low_power(), EXTI-pending wakes up CPU */
+    const uint32_t Mask_IRQ_CanWake_WithoutGlobalEnable = 1 << 4;
+    uint32_t sleep_start;
+
+    simpleButton_deep_sleep_clock_init();
+    sleep_start = simpleButton_deep_sleep_clock();
+    NVIC->SCTLR |= Mask_IRQ_CanWake_WithoutGlobalEnable;
+
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR, ENABLE);
+
+#if defined(__CH32V00x_H) // CH32V003 (RAM is kept and the code goes on)
+    PWR_EnterSTANDBYMode(PWR_STANDBYEntry_WFE);
+#else
+    PWR_EnterSTOPMode(PWR_Regulator_LowPower, PWR_STOPEntry_WFE);
+#endif
+
+    /* The system clock is HSI after waking up, restore HSE/PLL */
+    SystemInit();
+
+    /* SysTick was stopped, add the slept time before the EXTI is served */
+    SIMPLEBTN_FUNC_ADVANCE_TICK(simpleButton_deep_sleep_clock() - sleep_start);
+}
+
+// Read the cycle counter of the core.
+SIMPLEBTN_FORCE_INLINE uint32_t simpleButton_get_cycle(void)
+{
+#if defined(__CH32V00x_H) // CH32V003
+    /* QingKe V2 has no mcycle, use the SysTick counter (HCLK/8) */
+    return (uint32_t)HAL_GetCounter();
+#else
+    uint32_t cycle;
+    __asm volatile ("csrr %0, mcycle" : "=r"(cycle));
+    return cycle;
+#endif
+}
+
 /* ================================ END ================================ */
 
 #endif /* SIMPLEBUTTON_CONFIG_H__ */
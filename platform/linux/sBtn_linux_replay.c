@@ -0,0 +1,365 @@
+/**
+ * @file            sBtn_linux_replay.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the replay engine of the host-side (Linux)
+ *                  simulation backend. The virtual clock jumps from one edge
+ *                  or handler deadline to the next, so millions of edges are
+ *                  replayed per second.
+ *
+ *                  Waveform file: one edge per line, `<tick> <port><pin> <level>`,
+ *                  e.g. `1200 A0 0`. Ticks are in ascending order, `#` starts
+ *                  a comment.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2026-10-17
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/CH32-SimpleButton>
+ */
+#include    "sBtn_linux_replay.h"
+#include    <stdio.h>
+#include    <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* The button being replayed */
+static struct {
+
+    simpleButton_Type_PrivateBtnStatus_t    Private;
+
+    simpleButton_Type_PublicBtnStatus_t     Public;
+
+    SimpleButton_Type_SimReplay_t*          replay;
+
+} s_replay;
+
+/* Skip blanks, return the first other character */
+static const char* simpleButton_Sim_SkipBlank(const char* p)
+{
+    while (*p == ' ' || *p == '\t' || *p == '\r') {
+        p ++;
+    }
+    return p;
+}
+
+/* Parse one line of a waveform file. Return 1 for an edge, 0 for an empty line, -1 on error. */
+static int simpleButton_Sim_ParseEdge(const char* p, SimpleButton_Type_SimEdge_t* edge)
+{
+    uint32_t time = 0;
+    uint32_t pin = 0;
+    uint32_t port;
+
+    p = simpleButton_Sim_SkipBlank(p);
+    if (*p == '\n' || *p == '\0' || *p == '#') {
+        return 0;
+    }
+
+    if (*p < '0' || *p > '9') {
+        return -1;
+    }
+    while (*p >= '0' && *p <= '9') {
+        time = time * 10U + (uint32_t)(*p - '0');
+        p ++;
+    }
+
+    p = simpleButton_Sim_SkipBlank(p);
+    port = (uint32_t)((*p | 0x20) - 'a'); /* A ~ G, either case */
+    if (port >= SIMPLEBTN_SIM_PORT_NUM) {
+        return -1;
+    }
+    p ++;
+
+    if (*p < '0' || *p > '9') {
+        return -1;
+    }
+    while (*p >= '0' && *p <= '9') {
+        pin = pin * 10U + (uint32_t)(*p - '0');
+        p ++;
+    }
+    if (pin > 15) {
+        return -1;
+    }
+
+    p = simpleButton_Sim_SkipBlank(p);
+    if (*p != '0' && *p != '1') {
+        return -1;
+    }
+    edge->level = (uint8_t)(*p - '0');
+    p = simpleButton_Sim_SkipBlank(p + 1);
+    if (*p != '\n' && *p != '\0' && *p != '#') {
+        return -1;
+    }
+
+    edge->time = time;
+    edge->GPIO_Base = SIMPLEBTN_SIM_GPIO_BASE + port * SIMPLEBTN_SIM_GPIO_STRIDE;
+    edge->GPIO_Pin = (uint16_t)(1U << pin);
+    return 1;
+}
+
+/**
+ * @brief           Load a waveform file.
+ *
+ * @param[in]       path - The waveform file (see the head of this file).
+ * @param[out]      edges - The edges, free them with `SimpleButton_Sim_FreeWaveform()`.
+ * @param[out]      count - The number of edges.
+ *
+ * @return          0 on success, -1 if the file cannot be read,
+ *                  or the number of the first bad (or unsorted) line.
+ */
+int SimpleButton_Sim_LoadWaveform(const char* path, SimpleButton_Type_SimEdge_t** edges, uint32_t* count)
+{
+    FILE* file = fopen(path, "rb");
+    char* text;
+    const char* line;
+    long length;
+    uint32_t lines = 1;
+    uint32_t number = 0;
+    int result = 0;
+    long i;
+
+    *edges = 0;
+    *count = 0;
+
+    if (file == 0) {
+        return -1;
+    }
+    fseek(file, 0, SEEK_END);
+    length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    text = (char*)malloc((size_t)length + 1);
+    if (text == 0 || length < 0 || fread(text, 1, (size_t)length, file) != (size_t)length) {
+        free(text);
+        fclose(file);
+        return -1;
+    }
+    fclose(file);
+    text[length] = '\0';
+
+    for (i = 0; i < length; i++) {
+        lines += (text[i] == '\n') ? 1U : 0U;
+    }
+    *edges = (SimpleButton_Type_SimEdge_t*)malloc(sizeof(SimpleButton_Type_SimEdge_t) * lines);
+    if (*edges == 0) {
+        free(text);
+        return -1;
+    }
+
+    for (line = text; *line != '\0'; ) {
+        const char* end;
+        int parsed;
+
+        number ++;
+        parsed = simpleButton_Sim_ParseEdge(line, &((*edges)[*count]));
+        if (parsed < 0
+            || (parsed > 0 && *count > 0 && (*edges)[*count].time < (*edges)[*count - 1].time)
+        ) {
+            result = (int)number;
+            break;
+        }
+        *count += (uint32_t)parsed;
+
+        for (end = line; *end != '\n' && *end != '\0'; end++) {
+        }
+        line = (*end == '\n') ? end + 1 : end;
+    }
+
+    free(text);
+    if (result != 0) {
+        SimpleButton_Sim_FreeWaveform(*edges);
+        *edges = 0;
+        *count = 0;
+    }
+    return result;
+}
+
+/**
+ * @brief           Save edges as a waveform file, e.g. to add generated
+ *                  waveforms to a corpus.
+ * @return          0 on success, -1 if the file cannot be written.
+ */
+int SimpleButton_Sim_SaveWaveform(const char* path, const SimpleButton_Type_SimEdge_t* edges, uint32_t count)
+{
+    FILE* file = fopen(path, "w");
+    uint32_t i;
+
+    if (file == 0) {
+        return -1;
+    }
+
+    for (i = 0; i < count; i++) {
+        const uint32_t port = (edges[i].GPIO_Base - SIMPLEBTN_SIM_GPIO_BASE) / SIMPLEBTN_SIM_GPIO_STRIDE;
+
+        fprintf(file, "%lu %c%d %u\n", (unsigned long)edges[i].time,
+            (char)('A' + port), __builtin_ctz(edges[i].GPIO_Pin), (unsigned)edges[i].level);
+    }
+
+    return (fclose(file) == 0) ? 0 : -1;
+}
+
+void SimpleButton_Sim_FreeWaveform(SimpleButton_Type_SimEdge_t* edges)
+{
+    free(edges);
+}
+
+/* Record one callback of the replayed button */
+static void simpleButton_Sim_ReplayPost(const uint8_t kind, const uint32_t value)
+{
+    SimpleButton_Type_SimReplay_t* const replay = s_replay.replay;
+
+    if (replay->eventNum < replay->eventMax) {
+        SimpleButton_Type_SimReplayEvent_t* const event = &(replay->events[replay->eventNum]);
+
+        event->time = SimpleButton_Sim_GetTick();
+        event->value = value;
+        event->kind = kind;
+    }
+    replay->eventNum ++;
+}
+
+static void simpleButton_Sim_ReplayShort(void)
+{
+    simpleButton_Sim_ReplayPost(SimpleButton_Sim_Replay_Short, 0);
+}
+
+#if SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH == 0
+static void simpleButton_Sim_ReplayLong(void)
+{
+    simpleButton_Sim_ReplayPost(SimpleButton_Sim_Replay_Long, 0);
+}
+#else
+static void simpleButton_Sim_ReplayLong(uint32_t longPushTime)
+{
+    simpleButton_Sim_ReplayPost(SimpleButton_Sim_Replay_Long, longPushTime);
+}
+#endif /* SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH == 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0
+static void simpleButton_Sim_ReplayRepeat(void)
+{
+    simpleButton_Sim_ReplayPost(SimpleButton_Sim_Replay_Repeat, 0);
+}
+#else
+static void simpleButton_Sim_ReplayRepeat(uint8_t repeatCount)
+{
+    simpleButton_Sim_ReplayPost(SimpleButton_Sim_Replay_Repeat, repeatCount);
+}
+#endif /* SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0
+static void simpleButton_Sim_ReplayPress(void)
+{
+    simpleButton_Sim_ReplayPost(SimpleButton_Sim_Replay_Press, 0);
+}
+
+static void simpleButton_Sim_ReplayRelease(void)
+{
+    simpleButton_Sim_ReplayPost(SimpleButton_Sim_Replay_Release, 0);
+}
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0 */
+
+/* The EXTI interrupt function of the replayed button */
+static void simpleButton_Sim_ReplayIRQ(void)
+{
+    const uint16_t pin = s_replay.replay->GPIO_Pin;
+
+    if (EXTI_GetITStatus(pin) == SET) {
+        simpleButton_Private_InterruptHandler(&(s_replay.Private), pin);
+        EXTI_ClearITPendingBit(pin);
+    }
+}
+
+/**
+ * @brief           Replay a waveform through the interrupt handler and the
+ *                  asynchronous handler of one button. The simulator is reset.
+ *
+ * @param[in]       edges - Pin changes sorted by time, the edges of other pins are skipped.
+ * @param[in]       count - The number of edges.
+ * @param[inout]    replay - The button to replay, and the events emitted.
+ *
+ * @note            The handler runs when an edge is applied and at the deadline
+ *                  it returns, instead of once per tick, which gives the same
+ *                  events as `SimpleButton_Sim_RunWaveform()` with a
+ *                  deadline-aware main loop. The replay ends when the edges are
+ *                  used up and the button is idle, or `tail` ticks after the
+ *                  last edge (a button held down). Combination buttons and the
+ *                  registry are not replayed.
+ *
+ * @return          None
+ */
+void SimpleButton_Sim_Replay(
+    const SimpleButton_Type_SimEdge_t*  edges,
+    uint32_t                            count,
+    SimpleButton_Type_SimReplay_t*      replay
+) {
+    const uint32_t base = replay->GPIO_Base;
+    const uint16_t pin = replay->GPIO_Pin;
+    const simpleButton_Type_GPIOPinVal_t normal = SIMPLEBTN_NORMAL_PIN_VAL(replay->trigger);
+    uint32_t index = 0;
+    uint32_t endTime = 0;
+
+    s_replay.replay = replay;
+    replay->eventNum = 0;
+    replay->edges = 0;
+    replay->passes = 0;
+
+    SimpleButton_Sim_Reset();
+    SimpleButton_Sim_ConfigEXTI(base, pin, replay->trigger);
+    SimpleButton_Sim_AttachIRQ(pin, simpleButton_Sim_ReplayIRQ); /* EXTI line x serves GPIO pin x */
+
+    simpleButton_Private_InitStructPrivate(&(s_replay.Private));
+    simpleButton_Private_InitStructPublic(&(s_replay.Public));
+    if (replay->publicInit != 0) {
+        s_replay.Public = *(replay->publicInit);
+    }
+#if SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0
+    s_replay.Public.pressCallBack = simpleButton_Sim_ReplayPress;
+    s_replay.Public.releaseCallBack = simpleButton_Sim_ReplayRelease;
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT != 0 */
+
+    for (;;) {
+        const uint32_t now = SimpleButton_Sim_GetTick();
+        uint32_t next;
+
+        for (; index < count && (int32_t)(edges[index].time - now) <= 0; index++) {
+            if (edges[index].GPIO_Base == base && (edges[index].GPIO_Pin & pin) != 0) {
+                SimpleButton_Sim_WritePin(base, pin, edges[index].level);
+                replay->edges ++;
+            }
+        }
+
+        next = simpleButton_Private_AsynchronousHandler(
+            &(s_replay.Private), &(s_replay.Public), base, pin, normal, now,
+            simpleButton_Sim_ReplayShort, simpleButton_Sim_ReplayLong, simpleButton_Sim_ReplayRepeat
+        );
+        replay->passes ++;
+
+        while (index < count && (edges[index].GPIO_Base != base || (edges[index].GPIO_Pin & pin) == 0)) {
+            index ++;
+        }
+        if (index < count) {
+            next = SimpleButton_EarlierDeadline(next, edges[index].time);
+            endTime = edges[index].time + replay->tail;
+        } else if (next == SIMPLEBTN__DEADLINE_NEVER || (int32_t)(next - endTime) > 0) {
+            break; /* no edge left, and the button is idle or held down */
+        }
+
+        if ((int32_t)(next - now) <= 0) {
+            next = now + 1;
+        }
+        SimpleButton_Sim_AdvanceTime(next - now);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
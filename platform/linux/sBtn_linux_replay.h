@@ -0,0 +1,116 @@
+/**
+ * @file            sBtn_linux_replay.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the replay engine of the host-side (Linux)
+ *                  simulation backend. It feeds a recorded (or generated) pin
+ *                  waveform through the unmodified interrupt handler and
+ *                  asynchronous handler of one button, and reports the
+ *                  events emitted and their ticks.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2026-10-17
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/CH32-SimpleButton>
+ */
+#ifndef     SIMPLEBUTTON_LINUX_REPLAY_H__
+#define     SIMPLEBUTTON_LINUX_REPLAY_H__   0001L
+
+#include    "Simple_Button.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* ======================= Replay Types ================================ */
+
+/* enum for the kind of replayed event. */
+typedef enum SimpleButton_Type_SimReplayKind_t {
+    SimpleButton_Sim_Replay_Short = 0,
+
+    SimpleButton_Sim_Replay_Long,
+
+    SimpleButton_Sim_Replay_Repeat,
+
+    SimpleButton_Sim_Replay_Press, /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT only */
+
+    SimpleButton_Sim_Replay_Release, /* SIMPLEBTN_MODE_ENABLE_PRESS_EVENT only */
+
+} SimpleButton_Type_SimReplayKind_t;
+
+/**
+ * @struct      SimpleButton_Type_SimReplayEvent_t
+ *
+ * @brief       One callback of the replayed button.
+ */
+typedef struct SimpleButton_Type_SimReplayEvent_t {
+
+    uint32_t                        time;           /* tick of the callback */
+
+    uint32_t                        value;          /* long push time / repeat count, 0 if the mode is off */
+
+    uint8_t                         kind;           /* SimpleButton_Type_SimReplayKind_t */
+
+} SimpleButton_Type_SimReplayEvent_t;
+
+/**
+ * @struct      SimpleButton_Type_SimReplay_t
+ *
+ * @brief       The button to replay, and the result of the replay.
+ */
+typedef struct SimpleButton_Type_SimReplay_t {
+
+    /* in */
+
+    uint32_t                            GPIO_Base;
+
+    uint16_t                            GPIO_Pin;
+
+    EXTITrigger_TypeDef                 trigger;
+
+    const simpleButton_Type_PublicBtnStatus_t* publicInit;  /* times of the button, 0: defaults */
+
+    SimpleButton_Type_SimReplayEvent_t* events;             /* can be 0 if `eventMax` is 0 */
+
+    uint32_t                            eventMax;
+
+    uint32_t                            tail;           /* ticks replayed after the last edge at most */
+
+    /* out */
+
+    uint32_t                            eventNum;       /* events emitted (more than `eventMax` are counted only) */
+
+    uint32_t                            edges;          /* edges of the pin */
+
+    uint32_t                            passes;         /* calls of the asynchronous handler */
+
+} SimpleButton_Type_SimReplay_t;
+
+/* ======================= Waveform Files ============================== */
+
+int SimpleButton_Sim_LoadWaveform(const char* path, SimpleButton_Type_SimEdge_t** edges, uint32_t* count);
+
+int SimpleButton_Sim_SaveWaveform(const char* path, const SimpleButton_Type_SimEdge_t* edges, uint32_t count);
+
+void SimpleButton_Sim_FreeWaveform(SimpleButton_Type_SimEdge_t* edges);
+
+/* ======================= Replay ====================================== */
+
+void SimpleButton_Sim_Replay(
+    const SimpleButton_Type_SimEdge_t*  edges,
+    uint32_t                            count,
+    SimpleButton_Type_SimReplay_t*      replay
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SIMPLEBUTTON_LINUX_REPLAY_H__ */
@@ -0,0 +1,605 @@
+/**
+ * @file            sBtn_linux_sim.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the host-side (Linux) simulation backend.
+ *                  Virtual time only moves when the simulation asks it to,
+ *                  so a waveform of several minutes runs in microseconds.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2026-10-17
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/CH32-SimpleButton>
+ */
+#define     _POSIX_C_SOURCE     199309L /* clock_gettime() */
+#include    "sBtn_linux_sim.h"
+#include    <time.h>
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define SIMPLEBTN_SIM_EXTI_LINE_NUM     16
+
+/* The whole simulated machine */
+static struct {
+
+    uint32_t                            tick;
+
+    uint32_t                            tickLost;       /* SysTick ticks missed in STOP */
+
+    uint32_t                            wakeTime;       /* next edge of the waveform runner */
+
+    uint16_t                            portIDR[SIMPLEBTN_SIM_PORT_NUM];
+
+    uint16_t                            portLow[SIMPLEBTN_SIM_PORT_NUM];   /* open-drain outputs driven low */
+
+    uint8_t                             matrixRowPort;
+
+    uint8_t                             matrixColPort;
+
+    uint16_t                            matrixRows;
+
+    uint16_t                            matrixCols;
+
+    uint16_t                            matrixKeys[16];     /* pushed columns of each row line */
+
+    volatile uint16_t*                  ladderSamples;      /* the DMA buffer of the resistor ladder */
+
+    uint16_t                            ladderLength;
+
+    uint16_t                            ladderPos;          /* next sample written by the "DMA" */
+
+    uint8_t                             ladderChannels;
+
+    uint8_t                             extiPort[SIMPLEBTN_SIM_EXTI_LINE_NUM];
+
+    SimpleButton_Type_SimIRQHandler_t   extiHandler[SIMPLEBTN_SIM_EXTI_LINE_NUM];
+
+    uint32_t                            extiEnable;     /* INTENR */
+
+    uint32_t                            extiRising;     /* RTENR */
+
+    uint32_t                            extiFalling;    /* FTENR */
+
+    uint32_t                            extiPending;    /* INTFR */
+
+    uint8_t                             irqDisabled;
+
+    uint8_t                             inIRQ;
+
+    uint8_t                             waitForEvent;
+
+    uint8_t                             stopped;
+
+    uint8_t                             inRunner;
+
+    SimpleButton_Type_SimStats_t        stats;
+
+} s_sim;
+
+static uint32_t simpleButton_Sim_PortIndex(uint32_t GPIO_Base)
+{
+    uint32_t offset = GPIO_Base - SIMPLEBTN_SIM_GPIO_BASE;
+
+    if (GPIO_Base < SIMPLEBTN_SIM_GPIO_BASE
+        || (offset % SIMPLEBTN_SIM_GPIO_STRIDE) != 0
+        || (offset / SIMPLEBTN_SIM_GPIO_STRIDE) >= SIMPLEBTN_SIM_PORT_NUM
+    ) {
+        SimpleButton_Sim_Panic("unexpected GPIO port");
+    }
+
+    return offset / SIMPLEBTN_SIM_GPIO_STRIDE;
+}
+
+/* Call the attached EXTI functions for all pending and enabled lines */
+static void simpleButton_Sim_DeliverIRQ(void)
+{
+    uint32_t guard;
+
+    if (s_sim.irqDisabled != 0 || s_sim.inIRQ != 0) {
+        return; /* will be delivered when IRQ is enabled again */
+    }
+
+    s_sim.inIRQ = 1;
+
+    for (guard = 0; guard < SIMPLEBTN_SIM_EXTI_LINE_NUM; guard++) {
+        uint32_t active = s_sim.extiPending & s_sim.extiEnable;
+        uint32_t line;
+
+        if (active == 0) {
+            break;
+        }
+
+        line = (uint32_t)__builtin_ctz(active);
+
+        if (s_sim.extiHandler[line] == 0) {
+            s_sim.extiPending &= ~(1UL << line); /* no vector attached */
+            continue;
+        }
+
+        s_sim.stats.interrupts ++;
+        s_sim.extiHandler[line]();
+
+        if (s_sim.extiPending & (1UL << line)) {
+            break; /* not acknowledged, retry on the next event */
+        }
+    }
+
+    s_sim.inIRQ = 0;
+}
+
+/**
+ * @brief           Reset the virtual clock, ports, EXTI and statistics.
+ * @return          None
+ */
+void SimpleButton_Sim_Reset(void)
+{
+    memset(&s_sim, 0, sizeof(s_sim));
+}
+
+uint32_t SimpleButton_Sim_GetTick(void)
+{
+    return s_sim.tick - s_sim.tickLost;
+}
+
+void SimpleButton_Sim_SetTick(uint32_t tick)
+{
+    s_sim.tick = tick;
+    s_sim.tickLost = 0;
+}
+
+void SimpleButton_Sim_AdvanceTime(uint32_t ticks)
+{
+    s_sim.tick += ticks;
+}
+
+/**
+ * @brief           Drive the level of one or more pins of a virtual port.
+ *                  Matching EXTI edges are latched and delivered at once
+ *                  (or when IRQ is enabled again).
+ * @param[in]       GPIO_Base - The base address of the virtual port.
+ * @param[in]       GPIO_Pin - The pin mask.
+ * @param[in]       level - The new level (0 or 1).
+ * @return          None
+ */
+void SimpleButton_Sim_WritePin(uint32_t GPIO_Base, uint16_t GPIO_Pin, uint8_t level)
+{
+    uint32_t port = simpleButton_Sim_PortIndex(GPIO_Base);
+    uint16_t before = s_sim.portIDR[port];
+    uint16_t after = (level != 0) ? (uint16_t)(before | GPIO_Pin) : (uint16_t)(before & ~GPIO_Pin);
+    uint32_t rose = (uint32_t)(~before & after);
+    uint32_t fell = (uint32_t)(before & ~after);
+    uint32_t changed = rose | fell;
+
+    s_sim.portIDR[port] = after;
+
+    while (changed != 0) {
+        uint32_t line = (uint32_t)__builtin_ctz(changed);
+        uint32_t bit = 1UL << line;
+        changed &= ~bit;
+
+        s_sim.stats.edges ++;
+
+        if ((s_sim.extiEnable & bit) == 0 || s_sim.extiPort[line] != port) {
+            continue;
+        }
+
+        if ((s_sim.extiRising & rose & bit) || (s_sim.extiFalling & fell & bit)) {
+            s_sim.extiPending |= bit;
+        }
+    }
+
+    simpleButton_Sim_DeliverIRQ();
+}
+
+uint8_t SimpleButton_Sim_ReadPin(uint32_t GPIO_Base, uint16_t GPIO_Pin)
+{
+    return (s_sim.portIDR[simpleButton_Sim_PortIndex(GPIO_Base)] & GPIO_Pin) ? 1 : 0;
+}
+
+uint16_t SimpleButton_Sim_ReadPort(uint32_t GPIO_Base)
+{
+    return s_sim.portIDR[simpleButton_Sim_PortIndex(GPIO_Base)];
+}
+
+/* The columns of the key matrix follow the rows driven low, through every
+   path of pushed keys (so 3 keys on the corners of a rectangle ghost the 4th) */
+static void simpleButton_Sim_MatrixUpdate(void)
+{
+    uint16_t rowsLow, cols = 0, before, rowsBefore;
+    uint32_t line;
+
+    if (s_sim.matrixCols == 0) {
+        return; /* no key matrix */
+    }
+
+    rowsLow = s_sim.portLow[s_sim.matrixRowPort] & s_sim.matrixRows;
+    do {
+        before = cols;
+        rowsBefore = rowsLow;
+        for (line = 0; line < 16; line++) {
+            if ((rowsLow >> line) & 1U) {
+                cols |= s_sim.matrixKeys[line];
+            } else if ((s_sim.matrixKeys[line] & cols) != 0) {
+                rowsLow |= (uint16_t)(1U << line);
+            }
+        }
+    } while (cols != before || rowsLow != rowsBefore);
+
+    SimpleButton_Sim_WritePin(SIMPLEBTN_SIM_GPIO_BASE + s_sim.matrixColPort * SIMPLEBTN_SIM_GPIO_STRIDE,
+        (uint16_t)(s_sim.matrixCols & ~cols), 1);   /* pull-up */
+    SimpleButton_Sim_WritePin(SIMPLEBTN_SIM_GPIO_BASE + s_sim.matrixColPort * SIMPLEBTN_SIM_GPIO_STRIDE,
+        cols, 0);
+}
+
+/**
+ * @brief           Write open-drain outputs at once, like the BSHR register:
+ *                  the `SetPins` are released (pulled high), the `ResetPins`
+ *                  are driven low. Set wins if a pin is in both.
+ * @param[in]       GPIO_Base - The base address of the virtual port.
+ * @param[in]       SetPins - The pins released.
+ * @param[in]       ResetPins - The pins driven low.
+ * @return          None
+ */
+void SimpleButton_Sim_WritePort(uint32_t GPIO_Base, uint16_t SetPins, uint16_t ResetPins)
+{
+    uint32_t port = simpleButton_Sim_PortIndex(GPIO_Base);
+
+    s_sim.portLow[port] = (uint16_t)((s_sim.portLow[port] | ResetPins) & ~SetPins);
+    s_sim.portIDR[port] = (uint16_t)((s_sim.portIDR[port] | SetPins) & ~s_sim.portLow[port]);
+
+    simpleButton_Sim_MatrixUpdate();
+}
+
+/**
+ * @brief           Attach a key matrix: a key connects one row pin (an
+ *                  open-drain output) to one column pin (a pull-up input).
+ *                  All keys are released.
+ * @param[in]       Row_Base - The base address of the port of the rows.
+ * @param[in]       Row_Pins - The row pins.
+ * @param[in]       Col_Base - The base address of the port of the columns.
+ * @param[in]       Col_Pins - The column pins.
+ * @return          None
+ */
+void SimpleButton_Sim_MatrixAttach(uint32_t Row_Base, uint16_t Row_Pins, uint32_t Col_Base, uint16_t Col_Pins)
+{
+    s_sim.matrixRowPort = (uint8_t)simpleButton_Sim_PortIndex(Row_Base);
+    s_sim.matrixColPort = (uint8_t)simpleButton_Sim_PortIndex(Col_Base);
+    s_sim.matrixRows = Row_Pins;
+    s_sim.matrixCols = Col_Pins;
+    memset(s_sim.matrixKeys, 0, sizeof(s_sim.matrixKeys));
+
+    simpleButton_Sim_MatrixUpdate();
+}
+
+/**
+ * @brief           Push or release the key between a row pin and a column pin.
+ * @param[in]       Row_Pin - The row pin of the key.
+ * @param[in]       Col_Pin - The column pin of the key.
+ * @param[in]       pushed - 1: push, 0: release.
+ * @return          None
+ */
+void SimpleButton_Sim_MatrixKey(uint16_t Row_Pin, uint16_t Col_Pin, uint8_t pushed)
+{
+    uint32_t line = (uint32_t)__builtin_ctz(Row_Pin);
+
+    if (pushed != 0) {
+        s_sim.matrixKeys[line] |= Col_Pin;
+    } else {
+        s_sim.matrixKeys[line] &= (uint16_t)~Col_Pin;
+    }
+
+    simpleButton_Sim_MatrixUpdate();
+}
+
+/**
+ * @brief           Attach the circular DMA buffer of a resistor ladder,
+ *                  like the ADC scan + DMA started on the chip.
+ * @param[in]       Samples - The buffer.
+ * @param[in]       SampleNum - The length of the buffer.
+ * @param[in]       ChannelNum - The conversions of one scan round.
+ * @return          None
+ */
+void SimpleButton_Sim_LadderAttach(volatile uint16_t* Samples, uint16_t SampleNum, uint8_t ChannelNum)
+{
+    s_sim.ladderSamples = Samples;
+    s_sim.ladderLength = SampleNum;
+    s_sim.ladderChannels = ChannelNum;
+    s_sim.ladderPos = 0;
+}
+
+/**
+ * @brief           Feed one scan round of conversions (one value per ladder
+ *                  channel, in rank order) into the DMA buffer. The test
+ *                  calls it as often as the ADC would convert, with the
+ *                  noise it wants to model.
+ * @param[in]       Values - The ADC values of all channels.
+ * @return          None
+ */
+void SimpleButton_Sim_LadderConvert(const uint16_t* Values)
+{
+    uint8_t channel;
+
+    if (s_sim.ladderSamples == 0) {
+        return; /* no ladder */
+    }
+
+    for (channel = 0; channel < s_sim.ladderChannels; channel++) {
+        s_sim.ladderSamples[s_sim.ladderPos] = Values[channel];
+        s_sim.ladderPos = (uint16_t)((s_sim.ladderPos + 1U) % s_sim.ladderLength);
+    }
+}
+
+/**
+ * @brief           Configure the pins as pull-up/pull-down inputs and route
+ *                  them to their EXTI lines, like `simpleButton_Private_InitEXTI`
+ *                  does on the chip. No edge is generated by the pull.
+ * @param[in]       GPIO_Base - The base address of the virtual port.
+ * @param[in]       GPIO_Pin - The pin mask.
+ * @param[in]       trigger - The EXTI trigger of the pins.
+ * @return          None
+ */
+void SimpleButton_Sim_ConfigEXTI(uint32_t GPIO_Base, uint16_t GPIO_Pin, EXTITrigger_TypeDef trigger)
+{
+    uint32_t port = simpleButton_Sim_PortIndex(GPIO_Base);
+    uint32_t lines = GPIO_Pin;
+
+    while (lines != 0) {
+        uint32_t line = (uint32_t)__builtin_ctz(lines);
+        lines &= lines - 1;
+        s_sim.extiPort[line] = (uint8_t)port;
+    }
+
+    s_sim.extiRising &= ~(uint32_t)GPIO_Pin;
+    s_sim.extiFalling &= ~(uint32_t)GPIO_Pin;
+
+    if (trigger == EXTI_Trigger_Falling || trigger == EXTI_Trigger_Rising_Falling) {
+        s_sim.extiFalling |= GPIO_Pin;
+    }
+    if (trigger == EXTI_Trigger_Rising || trigger == EXTI_Trigger_Rising_Falling) {
+        s_sim.extiRising |= GPIO_Pin;
+    }
+
+    if (trigger == EXTI_Trigger_Falling) {
+        s_sim.portIDR[port] |= GPIO_Pin;    /* pull-up */
+    } else if (trigger == EXTI_Trigger_Rising) {
+        s_sim.portIDR[port] &= ~GPIO_Pin;   /* pull-down */
+    }
+
+    s_sim.extiEnable |= GPIO_Pin;
+}
+
+/**
+ * @brief           Attach an interrupt function to a group of EXTI lines,
+ *                  like one entry of the interrupt vector table.
+ * @param[in]       EXTI_Lines - The EXTI lines served by the function.
+ * @param[in]       handler - The interrupt function, e.g. `EXTI15_10_IRQHandler`.
+ * @return          None
+ */
+void SimpleButton_Sim_AttachIRQ(uint32_t EXTI_Lines, SimpleButton_Type_SimIRQHandler_t handler)
+{
+    uint32_t line;
+
+    for (line = 0; line < SIMPLEBTN_SIM_EXTI_LINE_NUM; line++) {
+        if (EXTI_Lines & (1UL << line)) {
+            s_sim.extiHandler[line] = handler;
+        }
+    }
+}
+
+uint32_t SimpleButton_Sim_EXTI_GetPending(void)
+{
+    return s_sim.extiPending;
+}
+
+void SimpleButton_Sim_EXTI_ClearPending(uint32_t EXTI_Lines)
+{
+    s_sim.extiPending &= ~EXTI_Lines;
+}
+
+/**
+ * @brief           Mask EXTI lines (clear their INTENR bits), no edge is latched
+ *                  on a masked line.
+ * @param[in]       EXTI_Lines - The lines to mask.
+ * @return          None
+ */
+void SimpleButton_Sim_EXTI_Mask(uint32_t EXTI_Lines)
+{
+    s_sim.extiEnable &= ~EXTI_Lines;
+}
+
+/**
+ * @brief           Clear the pending flags of EXTI lines and unmask them.
+ * @param[in]       EXTI_Lines - The lines to re-arm.
+ * @return          None
+ */
+void SimpleButton_Sim_EXTI_Unmask(uint32_t EXTI_Lines)
+{
+    s_sim.extiPending &= ~EXTI_Lines;
+    s_sim.extiEnable |= EXTI_Lines;
+}
+
+void SimpleButton_Sim_DisableIRQ(void)
+{
+    s_sim.irqDisabled = 1;
+}
+
+void SimpleButton_Sim_EnableIRQ(void)
+{
+    s_sim.irqDisabled = 0;
+    simpleButton_Sim_DeliverIRQ();
+}
+
+/**
+ * @brief           Simulated `__WFE()`. The waveform runner skips the virtual
+ *                  clock forward to the next scripted edge after the current
+ *                  loop pass. Returns at once if an EXTI is already pending.
+ * @return          None
+ */
+void SimpleButton_Sim_WaitForEvent(void)
+{
+    if ((s_sim.extiPending & s_sim.extiEnable) != 0) {
+        return; /* pending event wakes up the CPU immediately */
+    }
+
+    s_sim.waitForEvent = 1;
+}
+
+/**
+ * @brief           Simulated STOP mode. The virtual SysTick stops while the
+ *                  virtual RTC (`SimpleButton_Sim_GetRtc`) runs on until the
+ *                  next scripted edge, so `SimpleButton_Sim_GetTick()` lags
+ *                  behind until `SimpleButton_Sim_CompensateTick()` is called.
+ *                  Returns at once if an EXTI is already pending, or if it is
+ *                  not called from the waveform runner.
+ * @return          None
+ */
+void SimpleButton_Sim_EnterStop(void)
+{
+    uint32_t slept;
+
+    if ((s_sim.extiPending & s_sim.extiEnable) != 0 || s_sim.inRunner == 0) {
+        return; /* pending event wakes up the CPU immediately */
+    }
+
+    if ((int32_t)(s_sim.wakeTime - s_sim.tick) <= 0) {
+        return;
+    }
+
+    slept = s_sim.wakeTime - s_sim.tick;
+    s_sim.stats.stopTicks += slept;
+    s_sim.tickLost += slept;
+    s_sim.tick = s_sim.wakeTime;
+    s_sim.stopped = 1;
+}
+
+/**
+ * @brief           The virtual RTC, it keeps running in simulated STOP mode.
+ * @return          The real virtual time.
+ */
+uint32_t SimpleButton_Sim_GetRtc(void)
+{
+    return s_sim.tick;
+}
+
+/**
+ * @brief           Advance the virtual SysTick by the time slept in STOP mode.
+ * @param[in]       ticks - The slept time measured by the RTC.
+ * @return          None
+ */
+void SimpleButton_Sim_CompensateTick(uint32_t ticks)
+{
+    s_sim.tickLost -= ticks;
+}
+
+/**
+ * @brief           The cycle counter of the host, in nanoseconds of the
+ *                  monotonic clock. Used by the profiling mode.
+ * @return          The low 32 bits of the counter.
+ */
+uint32_t SimpleButton_Sim_GetCycle(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)ts.tv_sec * 1000000000UL + (uint32_t)ts.tv_nsec;
+}
+
+void SimpleButton_Sim_Panic(const char* cause)
+{
+    fprintf(stderr, "[Simple-Button] panic at tick %lu: %s\n",
+        (unsigned long)s_sim.tick, cause);
+    abort();
+}
+
+/**
+ * @brief           Run the main loop against a scripted waveform.
+ *
+ * @param[in]       edges - Pin changes sorted by time (can be NULL if `count` is 0).
+ * @param[in]       count - The number of edges.
+ * @param[in]       endTime - The virtual tick at which the run stops.
+ * @param[in]       loopBody - One pass of the main loop, called once per tick.
+ *
+ * @note            At each tick, the edges due are applied first (their EXTI
+ *                  functions run at once), then `loopBody` is called. If the
+ *                  loop body entered low-power, the clock jumps straight to the
+ *                  next edge, as a real `__WFE()` would sleep until then.
+ *                  A simulated STOP (`SimpleButton_Sim_EnterStop`) has already
+ *                  moved the clock to the next edge when the loop body returns.
+ *
+ * @return          None
+ */
+void SimpleButton_Sim_RunWaveform(
+    const SimpleButton_Type_SimEdge_t*  edges,
+    uint32_t                            count,
+    uint32_t                            endTime,
+    SimpleButton_Type_SimLoopBody_t     loopBody
+) {
+    uint32_t index = 0;
+
+    s_sim.inRunner = 1;
+
+    for (;;) {
+        uint32_t target;
+
+        while (index < count && (int32_t)(edges[index].time - s_sim.tick) <= 0) {
+            SimpleButton_Sim_WritePin(edges[index].GPIO_Base, edges[index].GPIO_Pin, edges[index].level);
+            index ++;
+        }
+
+        s_sim.wakeTime = (index < count) ? edges[index].time : endTime;
+        if ((int32_t)(endTime - s_sim.wakeTime) < 0) {
+            s_sim.wakeTime = endTime;
+        }
+
+        s_sim.waitForEvent = 0;
+        s_sim.stopped = 0;
+        if (loopBody != 0) {
+            loopBody();
+            s_sim.stats.loopPasses ++;
+        }
+
+        if ((int32_t)(endTime - s_sim.tick) <= 0) {
+            break;
+        }
+
+        target = s_sim.tick + 1;
+        if (s_sim.stopped != 0) {
+            target = s_sim.tick; /* woken up by the edge due now */
+        } else if (s_sim.waitForEvent != 0) {
+            target = (index < count) ? edges[index].time : endTime;
+            if ((int32_t)(endTime - target) < 0) {
+                target = endTime;
+            }
+            if ((int32_t)(target - s_sim.tick) <= 0) {
+                target = s_sim.tick + 1;
+            }
+            s_sim.stats.sleepTicks += target - s_sim.tick - 1;
+        }
+
+        s_sim.tick = target;
+    }
+
+    s_sim.waitForEvent = 0;
+    s_sim.inRunner = 0;
+}
+
+void SimpleButton_Sim_GetStats(SimpleButton_Type_SimStats_t* stats)
+{
+    *stats = s_sim.stats;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,231 @@
+/**
+ * @file            sBtn_linux_sim.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the host-side (Linux) simulation backend.
+ *                  It provides a virtual clock, virtual GPIO ports and a
+ *                  virtual EXTI controller, so that the unmodified state
+ *                  machine can be driven by scripted waveforms much faster
+ *                  than real time.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2026-10-17
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/CH32-SimpleButton>
+ */
+#ifndef     SIMPLEBUTTON_LINUX_SIM_H__
+#define     SIMPLEBUTTON_LINUX_SIM_H__      0001L
+
+#include    <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* ================= CH32 Standard-Lib compatible names ================ */
+
+/*
+ * The names below mirror the CH32 standard peripheral library, so that
+ * the button tables and the EXTI interrupt functions written for the board
+ * can be compiled unchanged on the host.
+ */
+
+#define SIMPLEBTN_SIM_GPIO_BASE         ((uint32_t)0x40010800)
+#define SIMPLEBTN_SIM_GPIO_STRIDE       ((uint32_t)0x00000400)
+#define SIMPLEBTN_SIM_PORT_NUM          7
+
+#define GPIOA_BASE      (SIMPLEBTN_SIM_GPIO_BASE + 0 * SIMPLEBTN_SIM_GPIO_STRIDE)
+#define GPIOB_BASE      (SIMPLEBTN_SIM_GPIO_BASE + 1 * SIMPLEBTN_SIM_GPIO_STRIDE)
+#define GPIOC_BASE      (SIMPLEBTN_SIM_GPIO_BASE + 2 * SIMPLEBTN_SIM_GPIO_STRIDE)
+#define GPIOD_BASE      (SIMPLEBTN_SIM_GPIO_BASE + 3 * SIMPLEBTN_SIM_GPIO_STRIDE)
+#define GPIOE_BASE      (SIMPLEBTN_SIM_GPIO_BASE + 4 * SIMPLEBTN_SIM_GPIO_STRIDE)
+#define GPIOF_BASE      (SIMPLEBTN_SIM_GPIO_BASE + 5 * SIMPLEBTN_SIM_GPIO_STRIDE)
+#define GPIOG_BASE      (SIMPLEBTN_SIM_GPIO_BASE + 6 * SIMPLEBTN_SIM_GPIO_STRIDE)
+
+#define GPIO_Pin_0      ((uint16_t)0x0001)
+#define GPIO_Pin_1      ((uint16_t)0x0002)
+#define GPIO_Pin_2      ((uint16_t)0x0004)
+#define GPIO_Pin_3      ((uint16_t)0x0008)
+#define GPIO_Pin_4      ((uint16_t)0x0010)
+#define GPIO_Pin_5      ((uint16_t)0x0020)
+#define GPIO_Pin_6      ((uint16_t)0x0040)
+#define GPIO_Pin_7      ((uint16_t)0x0080)
+#define GPIO_Pin_8      ((uint16_t)0x0100)
+#define GPIO_Pin_9      ((uint16_t)0x0200)
+#define GPIO_Pin_10     ((uint16_t)0x0400)
+#define GPIO_Pin_11     ((uint16_t)0x0800)
+#define GPIO_Pin_12     ((uint16_t)0x1000)
+#define GPIO_Pin_13     ((uint16_t)0x2000)
+#define GPIO_Pin_14     ((uint16_t)0x4000)
+#define GPIO_Pin_15     ((uint16_t)0x8000)
+#define GPIO_Pin_All    ((uint16_t)0xFFFF)
+
+#define EXTI_Line0      ((uint32_t)0x00001)
+#define EXTI_Line1      ((uint32_t)0x00002)
+#define EXTI_Line2      ((uint32_t)0x00004)
+#define EXTI_Line3      ((uint32_t)0x00008)
+#define EXTI_Line4      ((uint32_t)0x00010)
+#define EXTI_Line5      ((uint32_t)0x00020)
+#define EXTI_Line6      ((uint32_t)0x00040)
+#define EXTI_Line7      ((uint32_t)0x00080)
+#define EXTI_Line8      ((uint32_t)0x00100)
+#define EXTI_Line9      ((uint32_t)0x00200)
+#define EXTI_Line10     ((uint32_t)0x00400)
+#define EXTI_Line11     ((uint32_t)0x00800)
+#define EXTI_Line12     ((uint32_t)0x01000)
+#define EXTI_Line13     ((uint32_t)0x02000)
+#define EXTI_Line14     ((uint32_t)0x04000)
+#define EXTI_Line15     ((uint32_t)0x08000)
+
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+
+/* ======================= Simulation Types ============================ */
+
+/**
+ * @struct      SimpleButton_Type_SimEdge_t
+ *
+ * @brief       One step of a scripted waveform: at virtual tick `time`,
+ *              the pin `GPIO_Pin` of port `GPIO_Base` is driven to `level`.
+ *
+ * @note        Edges passed to `SimpleButton_Sim_RunWaveform` must be sorted
+ *              by `time` in ascending order.
+ */
+typedef struct SimpleButton_Type_SimEdge_t {
+
+    uint32_t                        time;
+
+    uint32_t                        GPIO_Base;
+
+    uint16_t                        GPIO_Pin;
+
+    uint8_t                         level;
+
+} SimpleButton_Type_SimEdge_t;
+
+/**
+ * @struct      SimpleButton_Type_SimStats_t
+ *
+ * @brief       Counters collected by the simulator since the last reset.
+ */
+typedef struct SimpleButton_Type_SimStats_t {
+
+    uint32_t                        edges;          /* pin level changes */
+
+    uint32_t                        interrupts;     /* EXTI handler entries */
+
+    uint32_t                        loopPasses;     /* calls of the loop body */
+
+    uint32_t                        sleepTicks;     /* ticks skipped by low-power */
+
+    uint32_t                        stopTicks;      /* ticks slept in simulated STOP */
+
+} SimpleButton_Type_SimStats_t;
+
+/* EXTI interrupt function type (one per interrupt vector) */
+typedef void (* SimpleButton_Type_SimIRQHandler_t)(void);
+
+/* Main-loop body type, called once per virtual tick */
+typedef void (* SimpleButton_Type_SimLoopBody_t)(void);
+
+/* ======================= Virtual Clock =============================== */
+
+void SimpleButton_Sim_Reset(void);
+
+uint32_t SimpleButton_Sim_GetTick(void);
+
+void SimpleButton_Sim_SetTick(uint32_t tick);
+
+void SimpleButton_Sim_AdvanceTime(uint32_t ticks);
+
+/* ======================= Virtual GPIO ================================ */
+
+void SimpleButton_Sim_WritePin(uint32_t GPIO_Base, uint16_t GPIO_Pin, uint8_t level);
+
+uint8_t SimpleButton_Sim_ReadPin(uint32_t GPIO_Base, uint16_t GPIO_Pin);
+
+uint16_t SimpleButton_Sim_ReadPort(uint32_t GPIO_Base);
+
+void SimpleButton_Sim_WritePort(uint32_t GPIO_Base, uint16_t SetPins, uint16_t ResetPins);
+
+/* ======================= Virtual Key Matrix ========================== */
+
+void SimpleButton_Sim_MatrixAttach(uint32_t Row_Base, uint16_t Row_Pins, uint32_t Col_Base, uint16_t Col_Pins);
+
+void SimpleButton_Sim_MatrixKey(uint16_t Row_Pin, uint16_t Col_Pin, uint8_t pushed);
+
+/* ======================= Virtual ADC (Resistor Ladder) =============== */
+
+void SimpleButton_Sim_LadderAttach(volatile uint16_t* Samples, uint16_t SampleNum, uint8_t ChannelNum);
+
+void SimpleButton_Sim_LadderConvert(const uint16_t* Values);
+
+/* ======================= Virtual EXTI ================================ */
+
+void SimpleButton_Sim_ConfigEXTI(uint32_t GPIO_Base, uint16_t GPIO_Pin, EXTITrigger_TypeDef trigger);
+
+void SimpleButton_Sim_AttachIRQ(uint32_t EXTI_Lines, SimpleButton_Type_SimIRQHandler_t handler);
+
+uint32_t SimpleButton_Sim_EXTI_GetPending(void);
+
+void SimpleButton_Sim_EXTI_ClearPending(uint32_t EXTI_Lines);
+
+void SimpleButton_Sim_EXTI_Mask(uint32_t EXTI_Lines);
+
+void SimpleButton_Sim_EXTI_Unmask(uint32_t EXTI_Lines);
+
+void SimpleButton_Sim_DisableIRQ(void);
+
+void SimpleButton_Sim_EnableIRQ(void);
+
+/* ======================= Low-Power / Panic =========================== */
+
+void SimpleButton_Sim_WaitForEvent(void);
+
+void SimpleButton_Sim_EnterStop(void);
+
+uint32_t SimpleButton_Sim_GetRtc(void);
+
+void SimpleButton_Sim_CompensateTick(uint32_t ticks);
+
+uint32_t SimpleButton_Sim_GetCycle(void);
+
+void SimpleButton_Sim_Panic(const char* cause);
+
+/* ======================= Waveform Runner ============================= */
+
+void SimpleButton_Sim_RunWaveform(
+    const SimpleButton_Type_SimEdge_t*  edges,
+    uint32_t                            count,
+    uint32_t                            endTime,
+    SimpleButton_Type_SimLoopBody_t     loopBody
+);
+
+void SimpleButton_Sim_GetStats(SimpleButton_Type_SimStats_t* stats);
+
+/* SPL compatible EXTI helpers, used inside the EXTI interrupt functions */
+static inline ITStatus EXTI_GetITStatus(uint32_t EXTI_Line) {
+    return (SimpleButton_Sim_EXTI_GetPending() & EXTI_Line) ? SET : RESET;
+}
+
+static inline void EXTI_ClearITPendingBit(uint32_t EXTI_Line) {
+    SimpleButton_Sim_EXTI_ClearPending(EXTI_Line);
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SIMPLEBUTTON_LINUX_SIM_H__ */
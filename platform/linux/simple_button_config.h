@@ -0,0 +1,386 @@
+/**
+ * @file            simple_button_config.h
+ * 
+ * @author          Kim-J-Smith
+ * 
+ * @brief           The configuration file of the Simple_Button file for the
+ *                  host-side (Linux) simulation backend. Use it instead of
+ *                  `Simple_Button/simple_button_config.h` to run the state
+ *                  machine on a virtual clock and virtual GPIO ports.
+ * 
+ * @version         0.8.x
+ * 
+ * @date            2025-10-03
+ * 
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ * 
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ * 
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ *                  <https://github.com/Kim-J-Smith/CH32-SimpleButton>
+ */
+#ifndef     SIMPLEBUTTON_CONFIG_H__
+#define     SIMPLEBUTTON_CONFIG_H__     1019L
+#include <stdint.h>
+
+/** @p ================================================================ **/
+/* ====================== CUSTOMIZATION BEGIN ========================== */
+
+
+/*************************************************************************
+ * @b Contents
+ * 
+ * 1. @e Head-File (Your head file depending on your chip)
+ * 
+ * 2. @e Simple-Button-Type (The Types used by Simple-Button)
+ * 
+ * 3. @e Other-Functions (Functions for read-pin, debug, low-power, ...)
+ * 
+ * 4. @e Time-Set (To set the adjustable time, such as repeat-push window. 
+ *                  All these times will be set as default times, 
+ *                  which can still be changed for each button.)
+ * 
+ * 5. @e Mode-Set (The mode of button, such as combination / timer-long-push / ...)
+ * 
+ * 6. @e Namespace (The namespace of Simple-Button public functions and variables)
+ * 
+ * 7. @e Initialization-Function (To init the GPIO, EXTI, NVIC/PFIC, etc)
+ * 
+ * 8. @e NVIC-EXTI-Priority (To specify the Priority of button)
+ * 
+ *************************************************************************
+ */
+
+/** @b ================================================================ **/
+/** @b Head-File */
+#include "sBtn_linux_sim.h"
+
+/** @b ================================================================ **/
+/** @b Simple-Button-Type */
+
+// The type of GPIOX_BASE. (X can be A / B / C ...)
+typedef uint32_t            simpleButton_Type_GPIOBase_t;
+// The type of GPIO_PIN_X. (X can be 0 / 1 / 2 / 3 / ...)
+typedef uint16_t            simpleButton_Type_GPIOPin_t;
+// The type of Value of Pin. (The value usually be 0 or 1)
+typedef uint8_t             simpleButton_Type_GPIOPinVal_t;
+// The type of EXTI_TRIGGER_X. (X can be FALLING / RAISING / ...)
+typedef EXTITrigger_TypeDef simpleButton_Type_EXTITrigger_t;
+
+#define SIMPLEBTN_EXTI_TRIGGER_FALLING      EXTI_Trigger_Falling
+
+/** @b ================================================================ **/
+/** @b Other-Functions */
+
+#define SIMPLEBTN_FUNC_READ_PIN(GPIOX_Base, Pin) \
+    SimpleButton_Sim_ReadPin(GPIOX_Base, Pin)
+
+#define SIMPLEBTN_FUNC_READ_PORT(GPIOX_Base) \
+    ((uint32_t)SimpleButton_Sim_ReadPort(GPIOX_Base)) /* used in port-sampling mode */
+
+#define SIMPLEBTN_FUNC_WRITE_PORT(GPIOX_Base, SetPins, ResetPins) \
+    SimpleButton_Sim_WritePort(GPIOX_Base, SetPins, ResetPins) /* used in matrix mode */
+
+#define SIMPLEBTN_FUNC_MATRIX_SETTLE() \
+    do { } while (0) /* used in matrix mode, the virtual columns follow at once */
+
+#define SIMPLEBTN_FUNC_EXTI_GET_PENDING() \
+    SimpleButton_Sim_EXTI_GetPending() /* used in exti-dispatch mode */
+
+#define SIMPLEBTN_FUNC_EXTI_CLEAR_PENDING(EXTI_Lines) \
+    SimpleButton_Sim_EXTI_ClearPending(EXTI_Lines) /* used in exti-dispatch mode */
+
+#define SIMPLEBTN_FUNC_EXTI_MASK(EXTI_Lines) \
+    SimpleButton_Sim_EXTI_Mask(EXTI_Lines) /* used in exti-masking mode */
+
+#define SIMPLEBTN_FUNC_EXTI_UNMASK(EXTI_Lines) \
+    SimpleButton_Sim_EXTI_Unmask(EXTI_Lines) /* used in exti-masking mode */
+
+#define SIMPLEBTN_FUNC_GET_TICK() \
+    SimpleButton_Sim_GetTick() // virtual clock, see SimpleButton_Sim_AdvanceTime()
+
+#define SIMPLEBTN_FUNC_GET_TICK_FromISR() \
+    SimpleButton_Sim_GetTick()
+
+#define SIMPLEBTN_FUNC_PANIC(Cause, ErrorNum, etc) \
+    do { simpleButton_debug_panic(Cause); } while(0) /* only used in DEBUG mode */
+
+#define SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN() \
+    SimpleButton_Sim_DisableIRQ()
+
+#define SIMPLEBTN_FUNC_CRITICAL_SECTION_END() \
+    SimpleButton_Sim_EnableIRQ()
+
+#define SIMPLEBTN_FUNC_START_LOW_POWER() \
+    simpleButton_start_low_power()
+
+#define SIMPLEBTN_FUNC_START_DEEP_SLEEP() \
+    simpleButton_start_deep_sleep() /* used in deep-sleep mode */
+
+#define SIMPLEBTN_FUNC_ADVANCE_TICK(Ms) \
+    SimpleButton_Sim_CompensateTick(Ms) /* used in deep-sleep mode */
+
+#define SIMPLEBTN_FUNC_GET_CYCLE() \
+    SimpleButton_Sim_GetCycle() /* host nanoseconds, used in profiling mode */
+
+/** @b ================================================================ **/
+/** @b Time-Set */
+
+    // The delay time after you push the button.
+#define SIMPLEBTN_TIME_PUSH_DELAY                       30
+    // The delay time after you release the button.
+#define SIMPLEBTN_TIME_RELEASE_DELAY                    30
+    // The minimum time to push the button for long-push.
+#define SIMPLEBTN_TIME_LONG_PUSH_MIN                    1000
+    // The window time for repeat-push.
+#define SIMPLEBTN_TIME_REPEAT_WINDOW                    300
+    // The cool-down time after you release the button.
+#define SIMPLEBTN_TIME_COOL_DOWN                        0
+    // The minimum time to push the button for long-push-hold.
+#define SIMPLEBTN_TIME_HOLD_PUSH_MIN                    SIMPLEBTN_TIME_LONG_PUSH_MIN
+    // The interval time to call callback function in hold-long-push mode.
+#define SIMPLEBTN_TIME_HOLD_INTERVAL                    200
+    // The timeout time for normal long button.
+#define SIMPLEBTN_TIME__TIMEOUT_NORMAL                  (1000 * 120)
+    // The timeout time for combination long button.
+#define SIMPLEBTN_TIME__TIMEOUT_COMBINATION             (1000 * 240)
+    // The sampling interval of the vertical debounce. (4 stable samples are needed)
+#define SIMPLEBTN_TIME_VERTICAL_SAMPLE                  5
+    // The poll interval reported as next deadline while the release (or a dynamic push) is awaited.
+#define SIMPLEBTN_TIME_POLL_INTERVAL                    10
+    // The sampling interval of the integrating debounce of a dynamic-button (the least time between two samples).
+#define SIMPLEBTN_TIME_INTEGRATE_INTERVAL               2
+    // The scan interval of a key matrix while one of its keys is busy.
+#define SIMPLEBTN_TIME_MATRIX_SCAN                      5
+    // The interval of the sample batches of a resistor ladder while one of its keys is busy.
+#define SIMPLEBTN_TIME_LADDER_SCAN                      5
+
+/** @b ================================================================ **/
+/** @b Mode-Set */
+
+    // Enable debug mode if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_DEBUG                     0
+    // Enable combination mode if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_COMBINATION               0
+    // Enable timer long-push mode if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH           0
+    // Enable counter repeat-push mode if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH       0
+    // Enable adjustable mode if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME           0
+    // Enable multi-threads mode(enable this only when you do use multi-thread) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_MULTI_THREADS             0
+    // Enable long-push-hold mode if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD             0
+    // Enable button registry (SimpleButton_ProcessAll) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_REGISTRY                  0
+    // The maximum number of buttons in the registry. (1 ~ 254)
+#define SIMPLEBTN_REGISTRY_CAPACITY                     32
+    // Enable port-sampling (read each GPIO port of the registry once per pass) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_PORT_SAMPLING             0
+    // The maximum number of different GPIO ports in the registry.
+#define SIMPLEBTN_REGISTRY_PORT_CAPACITY                5
+    // Enable vertical-counter debounce of the port snapshots if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_VERTICAL_DEBOUNCE         0
+    // Enable event queue (registry buttons report events instead of calling back) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_EVENT_QUEUE               0
+    // The number of slots in the event queue. (power of 2, 2 ~ 128, one slot is kept empty)
+#define SIMPLEBTN_EVENT_QUEUE_SIZE                      16
+    // Enable compact button state (16-bit time stamps, 6 bytes of private status per button) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_COMPACT_STATE             0
+    // Enable button table (X-macro list, one shared handler and interrupt entry) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_BUTTON_TABLE              0
+    // Enable the shared EXTI dispatcher (reads the pending flags once per interrupt) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_EXTI_DISPATCH             0
+    // Enable the deadline heap (SimpleButton_ProcessAll only runs the registry buttons whose deadline expired) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_DEADLINE_HEAP             0
+    // Enable deep-sleep mode (SIMPLEBTN__START_LOWPOWER enters STOP instead of SLEEP, the slept time is measured by the RTC, not on CH32V003) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_DEEP_SLEEP                0
+    // Enable EXTI masking (the EXTI line is masked from the accepted edge until the button waits for an edge again) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_EXTI_MASKING              0
+    // Enable profiling (cycle statistics of the interrupt, the states and the callbacks) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_PROFILING                 0
+    // The number of log2 histogram bins of the profiling statistics. (1 ~ 32, bin n counts 2^n ~ 2^(n+1)-1 cycles)
+#define SIMPLEBTN_PROFILE_HIST_BINS                     16
+    // Enable the trace recorder (state transitions, EXTI hits and callbacks in a RAM ring buffer) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_TRACE                     0
+    // The number of records in the trace ring buffer. (power of 2, 2 ~ 32768, 6 bytes per record)
+#define SIMPLEBTN_TRACE_SIZE                            256
+    // Enable press / release events (called when the push and the release are debounced) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_PRESS_EVENT               0
+    // Enable adaptive debounce (each button tunes its push / release delay to the bounce it measures) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE         0
+    // The bounds of the adaptive debounce window, and the margin kept above the measured bounce. (ticks, 1 <= MIN <= MAX <= 255)
+#define SIMPLEBTN_DEBOUNCE_MIN                          5
+#define SIMPLEBTN_DEBOUNCE_MAX                          30
+#define SIMPLEBTN_DEBOUNCE_MARGIN                       3
+    // Enable integrating debounce (dynamic-buttons follow the pin after N agreeing samples) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_INTEGRATING_DEBOUNCE      0
+    // The agreeing samples in a row needed to change the level of a dynamic-button. (1 ~ 127)
+#define SIMPLEBTN_INTEGRATE_SAMPLES                     4
+    // Enable key matrix mode (rows driven and columns read port-wide, one State-Machine per key) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_MATRIX                    0
+    // Enable resistor ladder mode (several keys on one ADC pin, sampled by scan + DMA, one State-Machine per key) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_LADDER                    0
+    // The conversion rounds of all ladder channels kept in the DMA buffer, averaged as one batch. (1 ~ 64)
+#define SIMPLEBTN_LADDER_BATCH                          8
+    // The ADC counts a new band must be closer than the current one before the key changes.
+#define SIMPLEBTN_LADDER_HYSTERESIS                     48
+    // A batch whose samples spread more than this (ADC counts) is moving and ignored.
+#define SIMPLEBTN_LADDER_SPREAD                         128
+    // The ADC value of a ladder channel with no key pushed (the pull-up).
+#define SIMPLEBTN_LADDER_RELEASED                       4095
+
+/** @b ================================================================ **/
+/** @b Namespace */
+
+/**
+ * @brief   The namespace of Simple-Button public functions and variables.
+ * 
+ * @note    This namespace can be changed to avoid name conflicts.
+ *          Default: SimpleButton_
+ */
+#define SIMPLEBTN_NAMESPACE                             SimpleButton_
+
+/** @b ================================================================ **/
+/** @b Initialization-Function */
+
+/* This macro just forward the parameter to another function */
+#define SIMPLEBTN_FUNC_INIT_EXTI(GPIOX_Base, GPIO_Pin_X, EXTI_Trigger_X) \
+    simpleButton_Private_InitEXTI(GPIOX_Base, GPIO_Pin_X, EXTI_Trigger_X)
+
+/* Init all the pins of one port at once (optional, used by `SimpleButton_Table_Init`) */
+#define SIMPLEBTN_FUNC_INIT_EXTI_PORT(GPIOX_Base, Pins_Falling, Pins_Rising) \
+    simpleButton_Private_InitEXTIPort(GPIOX_Base, Pins_Falling, Pins_Rising)
+
+/* Enable the NVIC channels of some EXTI lines at once (no NVIC in the simulator) */
+#define SIMPLEBTN_FUNC_INIT_EXTI_NVIC(EXTI_Lines) \
+    ((void)(EXTI_Lines))
+
+/* Init the rows (open-drain outputs, released) and the columns (pull-up inputs) of a key matrix */
+#define SIMPLEBTN_FUNC_INIT_MATRIX(Row_Base, Row_Pins, Col_Base, Col_Pins) \
+    simpleButton_Private_InitMatrix(Row_Base, Row_Pins, Col_Base, Col_Pins)
+
+/* Init the analog pin of one resistor ladder channel as the regular conversion `Rank` (0-based) */
+#define SIMPLEBTN_FUNC_INIT_LADDER_CHANNEL(GPIOX_Base, GPIO_Pin_X, ADC_Channel, Rank) \
+    simpleButton_Private_InitLadderChannel(GPIOX_Base, GPIO_Pin_X, ADC_Channel, Rank)
+
+/* Start converting all ladder channels again and again, written by DMA into a circular buffer */
+#define SIMPLEBTN_FUNC_INIT_LADDER_ADC(ChannelNum, Samples, SampleNum) \
+    simpleButton_Private_InitLadderADC(ChannelNum, Samples, SampleNum)
+
+
+/** @b ================================================================ **/
+/** @b NVIC-EXTI-Priority */
+
+#define SIMPLEBTN_NVIC_EXTI_PreemptionPriority      0
+
+#define SIMPLEBTN_NVIC_EXTI_SubPriority             0
+
+/* ====================== CUSTOMIZATION END ============================ */
+/** @p ================================================================ **/
+
+
+// Macro for force-inline
+#if defined(__GNUC__) || defined(__clang__)
+ #define SIMPLEBTN_FORCE_INLINE static inline __attribute__((always_inline))
+#elif defined(_MSC_VER) || defined(__CC_ARM)
+ #define SIMPLEBTN_FORCE_INLINE static __forceinline
+#else
+ #define SIMPLEBTN_FORCE_INLINE static inline
+#endif
+
+/* ================ OTHER LOCAL-PLATFORM CUSTOMIZATION ================= */
+
+static inline void simpleButton_debug_panic(const char* cause)
+{
+    /* print the cause and abort the simulation */
+    SimpleButton_Sim_Panic(cause);
+}
+
+// Init the EXTI (virtual)
+SIMPLEBTN_FORCE_INLINE
+void simpleButton_Private_InitEXTI(
+    simpleButton_Type_GPIOBase_t    GPIOX_Base,
+    simpleButton_Type_GPIOPin_t     GPIO_Pin_X,
+    simpleButton_Type_EXTITrigger_t EXTI_Trigger_X
+) {
+    /* Pull-up/pull-down input, route the pin to its EXTI line and enable it */
+    SimpleButton_Sim_ConfigEXTI(GPIOX_Base, GPIO_Pin_X, EXTI_Trigger_X);
+}
+
+// Init the EXTI of several pins of one port (virtual)
+SIMPLEBTN_FORCE_INLINE
+void simpleButton_Private_InitEXTIPort(
+    simpleButton_Type_GPIOBase_t    GPIOX_Base,
+    simpleButton_Type_GPIOPin_t     Pins_Falling,
+    simpleButton_Type_GPIOPin_t     Pins_Rising
+) {
+    if (Pins_Falling != 0) {
+        SimpleButton_Sim_ConfigEXTI(GPIOX_Base, Pins_Falling, EXTI_Trigger_Falling);
+    }
+    if (Pins_Rising != 0) {
+        SimpleButton_Sim_ConfigEXTI(GPIOX_Base, Pins_Rising, EXTI_Trigger_Rising);
+    }
+}
+
+// Init the pins of a key matrix (virtual)
+SIMPLEBTN_FORCE_INLINE
+void simpleButton_Private_InitMatrix(
+    simpleButton_Type_GPIOBase_t    Row_Base,
+    simpleButton_Type_GPIOPin_t     Row_Pins,
+    simpleButton_Type_GPIOBase_t    Col_Base,
+    simpleButton_Type_GPIOPin_t     Col_Pins
+) {
+    /* The keys are wired by SimpleButton_Sim_MatrixAttach(), release the rows */
+    (void)Col_Base;
+    (void)Col_Pins;
+    SimpleButton_Sim_WritePort(Row_Base, Row_Pins, 0);
+}
+
+// Init one channel of a resistor ladder (virtual)
+SIMPLEBTN_FORCE_INLINE
+void simpleButton_Private_InitLadderChannel(
+    simpleButton_Type_GPIOBase_t    GPIOX_Base,
+    simpleButton_Type_GPIOPin_t     GPIO_Pin_X,
+    uint8_t                         ADC_Channel,
+    uint8_t                         Rank
+) {
+    /* The voltages are fed by SimpleButton_Sim_LadderConvert() in rank order */
+    (void)GPIOX_Base;
+    (void)GPIO_Pin_X;
+    (void)ADC_Channel;
+    (void)Rank;
+}
+
+// Start the scan + DMA of a resistor ladder (virtual)
+SIMPLEBTN_FORCE_INLINE
+void simpleButton_Private_InitLadderADC(uint8_t ChannelNum, volatile uint16_t* Samples, uint16_t SampleNum)
+{
+    SimpleButton_Sim_LadderAttach(Samples, SampleNum, ChannelNum);
+}
+
+// Start the low-power mode. (simulated SLEEP)
+SIMPLEBTN_FORCE_INLINE void simpleButton_start_low_power(void)
+{
+    /* The waveform runner skips the virtual clock to the next edge */
+    SimpleButton_Sim_WaitForEvent();
+}
+
+// Start the deep low-power mode. (simulated STOP)
+SIMPLEBTN_FORCE_INLINE void simpleButton_start_deep_sleep(void)
+{
+    const uint32_t sleep_start = SimpleButton_Sim_GetRtc();
+
+    /* The virtual SysTick stops, the virtual RTC runs until the next edge */
+    SimpleButton_Sim_EnterStop();
+
+    /* SysTick was stopped, add the slept time before the EXTI is served */
+    SIMPLEBTN_FUNC_ADVANCE_TICK(SimpleButton_Sim_GetRtc() - sleep_start);
+}
+
+/* ================================ END ================================ */
+
+#endif /* SIMPLEBUTTON_CONFIG_H__ */
@@ -0,0 +1,194 @@
+/**
+ * @file            sBtn_replay.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Replay recorded or generated waveform files through the
+ *                  state machine on the host (see `platform/linux/sBtn_linux_replay.c`).
+ *                  Every pin found in a file is replayed as one button. The
+ *                  events go to stdout (diff them against a known-good run),
+ *                  the speed goes to stderr.
+ *
+ *                  Build (from the root of the repository, with the modes and
+ *                  times of the board in platform/linux/simple_button_config.h):
+ *                      gcc -O2 -I. -ISimple_Button -Iplatform/linux \
+ *                          -DSIMPLEBTN_CONFIG_FILE='"platform/linux/simple_button_config.h"' \
+ *                          tools/sBtn_replay.c platform/linux/sBtn_linux_replay.c \
+ *                          platform/linux/sBtn_linux_sim.c Simple_Button/Simple_Button.c \
+ *                          -o sbtn_replay
+ *
+ *                  Usage:  sbtn_replay [options] wave.txt...
+ *                      -r              buttons push to high (EXTI rising), default: to low
+ *                      -q              print the number of events only
+ *                      -T ms           ticks replayed after the last edge, default 60000
+ *                      -L / -W / -C ms long-push min / repeat window / cool down
+ *                                      (SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME only)
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2026-10-17
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/CH32-SimpleButton>
+ */
+#define     _POSIX_C_SOURCE     199309L /* clock_gettime() */
+#include    "sBtn_linux_replay.h"
+#include    <time.h>
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <string.h>
+
+#define SBTN_REPLAY_BUTTON_MAX          (SIMPLEBTN_SIM_PORT_NUM * 16)
+
+static const char* const s_kindName[] = { "short", "long", "repeat", "press", "release" };
+
+static double sbtn_Seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void sbtn_Usage(const char* name)
+{
+    fprintf(stderr, "usage: %s [-r] [-q] [-T ms]"
+#if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
+        " [-L ms] [-W ms] [-C ms]"
+#endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
+        " wave.txt...\n", name);
+}
+
+int main(int argc, char* argv[])
+{
+    simpleButton_Type_PublicBtnStatus_t publicInit;
+    SimpleButton_Type_SimReplay_t replay;
+    EXTITrigger_TypeDef trigger = EXTI_Trigger_Falling;
+    uint32_t tail = 60000;
+    int quiet = 0;
+    unsigned long totalEdges = 0, totalEvents = 0, files = 0;
+    double elapsed = 0;
+    int arg;
+
+    simpleButton_Private_InitStructPublic(&publicInit);
+
+    for (arg = 1; arg < argc && argv[arg][0] == '-'; arg++) {
+        const char option = argv[arg][1];
+
+        if (option == 'r') {
+            trigger = EXTI_Trigger_Rising;
+        } else if (option == 'q') {
+            quiet = 1;
+        } else if (option == 'T' && arg + 1 < argc) {
+            tail = (uint32_t)strtoul(argv[++arg], NULL, 0);
+#if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
+        } else if (option == 'L' && arg + 1 < argc) {
+            publicInit.longPushMinTime = (uint16_t)strtoul(argv[++arg], NULL, 0);
+        } else if (option == 'W' && arg + 1 < argc) {
+            publicInit.repeatWindowTime = (uint16_t)strtoul(argv[++arg], NULL, 0);
+        } else if (option == 'C' && arg + 1 < argc) {
+            publicInit.coolDownTime = (uint16_t)strtoul(argv[++arg], NULL, 0);
+#endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
+        } else {
+            sbtn_Usage(argv[0]);
+            return 2;
+        }
+    }
+    if (arg >= argc) {
+        sbtn_Usage(argv[0]);
+        return 2;
+    }
+
+    for (; arg < argc; arg++) {
+        SimpleButton_Type_SimEdge_t* edges;
+        SimpleButton_Type_SimReplayEvent_t* events;
+        uint32_t count, i;
+        uint32_t buttonBase[SBTN_REPLAY_BUTTON_MAX];
+        uint16_t buttonPin[SBTN_REPLAY_BUTTON_MAX];
+        unsigned buttonNum = 0, b;
+        int result = SimpleButton_Sim_LoadWaveform(argv[arg], &edges, &count);
+
+        if (result != 0) {
+            if (result < 0) {
+                fprintf(stderr, "%s: cannot read\n", argv[arg]);
+            } else {
+                fprintf(stderr, "%s:%d: bad or unsorted edge\n", argv[arg], result);
+            }
+            return 1;
+        }
+        files ++;
+
+        /* a button emits at most two events per edge (with the press events),
+           plus the long-push-hold ones */
+        events = (SimpleButton_Type_SimReplayEvent_t*)malloc(sizeof(SimpleButton_Type_SimReplayEvent_t) * (count * 2 + 1));
+        if (events == NULL) {
+            return 1;
+        }
+
+        /* one button per pin, in the order of appearance */
+        for (i = 0; i < count; i++) {
+            for (b = 0; b < buttonNum; b++) {
+                if (buttonBase[b] == edges[i].GPIO_Base && buttonPin[b] == edges[i].GPIO_Pin) {
+                    break;
+                }
+            }
+            if (b == buttonNum) {
+                buttonBase[buttonNum] = edges[i].GPIO_Base;
+                buttonPin[buttonNum] = edges[i].GPIO_Pin;
+                buttonNum ++;
+            }
+        }
+
+        for (b = 0; b < buttonNum; b++) {
+            const char port = (char)('A' + (buttonBase[b] - SIMPLEBTN_SIM_GPIO_BASE) / SIMPLEBTN_SIM_GPIO_STRIDE);
+            const int pin = __builtin_ctz(buttonPin[b]);
+            double start;
+
+            memset(&replay, 0, sizeof(replay));
+            replay.GPIO_Base = buttonBase[b];
+            replay.GPIO_Pin = buttonPin[b];
+            replay.trigger = trigger;
+            replay.publicInit = &publicInit;
+            replay.events = events;
+            replay.eventMax = count * 2 + 1;
+            replay.tail = tail;
+
+            start = sbtn_Seconds();
+            SimpleButton_Sim_Replay(edges, count, &replay);
+            elapsed += sbtn_Seconds() - start;
+
+            totalEdges += replay.edges;
+            totalEvents += replay.eventNum;
+
+            if (quiet) {
+                printf("%s %c%d events=%lu\n", argv[arg], port, pin, (unsigned long)replay.eventNum);
+                continue;
+            }
+            for (i = 0; i < replay.eventNum && i < replay.eventMax; i++) {
+                printf("%s %c%d %10lu %s", argv[arg], port, pin,
+                    (unsigned long)events[i].time, s_kindName[events[i].kind]);
+                if (events[i].value != 0) {
+                    printf(" %lu", (unsigned long)events[i].value);
+                }
+                printf("\n");
+            }
+            if (replay.eventNum > replay.eventMax) {
+                printf("%s %c%d ... %lu more events\n", argv[arg], port, pin,
+                    (unsigned long)(replay.eventNum - replay.eventMax));
+            }
+        }
+
+        free(events);
+        SimpleButton_Sim_FreeWaveform(edges);
+    }
+
+    fprintf(stderr, "%lu files, %lu edges, %lu events in %.3f s (%.2f M edges/s)\n",
+        files, totalEdges, totalEvents, elapsed,
+        (elapsed > 0) ? (double)totalEdges / elapsed * 1e-6 : 0.0);
+
+    return 0;
+}
@@ -0,0 +1,296 @@
+/**
+ * @file            sBtn_trace_decode.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Host-side decoder of the Simple-Button trace ring buffer
+ *                  (`SIMPLEBTN_MODE_ENABLE_TRACE`). It reads a raw dump of
+ *                  `SimpleButton_Type_Trace_t` and prints one timeline per
+ *                  button. It does not need the config file of the board.
+ *
+ *                  Build:  gcc -O2 -o sbtn_trace tools/sBtn_trace_decode.c
+ *                  Usage:  sbtn_trace [-n 0xADDR=Name]... trace.bin
+ *
+ *                  `0xADDR` is the low 16 bits of `&SimpleButton_xxx.Private`,
+ *                  as printed in the timeline headers.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2026-10-17
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/CH32-SimpleButton>
+ */
+#include    <stdint.h>
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <string.h>
+
+/* The layout of SimpleButton_Type_Trace_t (little-endian, see Simple_Button.h) */
+#define SBTN_TRACE_MAGIC                0x52544253UL
+#define SBTN_TRACE_HEADER_SIZE          16
+#define SBTN_TRACE_RECORD_SIZE          6
+
+#define SBTN_TRACE_KIND_TRANSITION      0
+#define SBTN_TRACE_KIND_EXTI            1
+#define SBTN_TRACE_KIND_CALLBACK        2
+#define SBTN_TRACE_KIND_TIME_HIGH       3
+
+#define SBTN_TRACE_STATES_COMBINATION   0x01
+#define SBTN_TRACE_STATES_HOLD          0x02
+
+#define SBTN_MAX_BUTTONS                64
+#define SBTN_MAX_NAMES                  64
+#define SBTN_STATE_NUM_MAX              16
+
+/* One decoded record */
+typedef struct {
+    uint32_t    time;
+    uint16_t    button;
+    uint8_t     kind;
+    uint8_t     arg;
+} sbtn_Event_t;
+
+/* The names given by -n */
+static struct {
+    uint16_t    button;
+    const char* name;
+} s_names[SBTN_MAX_NAMES];
+
+static unsigned s_nameNum = 0;
+
+static const char* s_stateName[SBTN_STATE_NUM_MAX];
+
+static unsigned s_stateNum = 0;
+
+static const char* const s_callBackName[] = { "short", "long", "repeat", "combination", "press", "release" };
+
+static uint32_t sbtn_Read32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t sbtn_Read16(const uint8_t* p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/* The state enum depends on the modes of the board */
+static void sbtn_BuildStateNames(uint8_t states)
+{
+    static const char* const base[] = {
+        "Wait_For_Interrupt", "Push_Delay", "Wait_For_End", "Wait_For_Repeat",
+        "Single_Push", "Repeat_Push", "Release_Delay", "Cool_Down",
+    };
+    unsigned i;
+
+    for (i = 0; i < sizeof(base) / sizeof(base[0]); i++) {
+        s_stateName[s_stateNum++] = base[i];
+    }
+    if ((states & SBTN_TRACE_STATES_COMBINATION) != 0) {
+        s_stateName[s_stateNum++] = "Combination_Push";
+        s_stateName[s_stateNum++] = "Combination_WaitForEnd";
+        s_stateName[s_stateNum++] = "Combination_Release";
+    }
+    if ((states & SBTN_TRACE_STATES_HOLD) != 0) {
+        s_stateName[s_stateNum++] = "Hold_Push";
+        s_stateName[s_stateNum++] = "Hold_Release";
+    }
+}
+
+static const char* sbtn_StateName(unsigned state)
+{
+    return (state < s_stateNum) ? s_stateName[state] : "?";
+}
+
+static const char* sbtn_ButtonName(uint16_t button)
+{
+    unsigned i;
+
+    for (i = 0; i < s_nameNum; i++) {
+        if (s_names[i].button == button) {
+            return s_names[i].name;
+        }
+    }
+    return "";
+}
+
+static int sbtn_ParseName(char* arg)
+{
+    char* eq = strchr(arg, '=');
+
+    if (eq == NULL || s_nameNum >= SBTN_MAX_NAMES) {
+        return -1;
+    }
+    *eq = '\0';
+    s_names[s_nameNum].button = (uint16_t)strtoul(arg, NULL, 0);
+    s_names[s_nameNum].name = eq + 1;
+    s_nameNum++;
+    return 0;
+}
+
+/* Print the timeline of one button. `state` is the state before the first record. */
+static void sbtn_PrintButton(const sbtn_Event_t* events, unsigned count, uint16_t button)
+{
+    unsigned state = s_stateNum; /* unknown */
+    unsigned i;
+
+    printf("button 0x%04X %s\n", (unsigned)button, sbtn_ButtonName(button));
+
+    for (i = 0; i < count; i++) {
+        const sbtn_Event_t* e = &events[i];
+
+        if (e->button != button) {
+            continue;
+        }
+
+        switch (e->kind) {
+        case SBTN_TRACE_KIND_TRANSITION:
+            if (e->arg == state) {
+                break; /* already reported by the EXTI record */
+            }
+            printf("  %10lu         %-22s -> %s\n", (unsigned long)e->time, sbtn_StateName(state), sbtn_StateName(e->arg));
+            state = e->arg;
+            break;
+
+        case SBTN_TRACE_KIND_EXTI:
+            if (e->arg != 0) {
+                printf("  %10lu  EXTI   %-22s -> %s\n", (unsigned long)e->time, sbtn_StateName(state), sbtn_StateName(1));
+                state = 1; /* Push_Delay */
+            } else {
+                printf("  %10lu  EXTI   ignored in %s\n", (unsigned long)e->time, sbtn_StateName(state));
+            }
+            break;
+
+        case SBTN_TRACE_KIND_CALLBACK:
+            printf("  %10lu  %s %s\n", (unsigned long)e->time,
+                ((e->arg & 0x80) != 0) ? "EVENT " : "CALL  ",
+                ((e->arg & 0x7F) < sizeof(s_callBackName) / sizeof(s_callBackName[0])) ? s_callBackName[e->arg & 0x7F] : "?");
+            break;
+
+        default:
+            printf("  %10lu  unknown record %u\n", (unsigned long)e->time, (unsigned)e->kind);
+            break;
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const char* path = NULL;
+    FILE* file;
+    uint8_t* dump;
+    long length;
+    uint32_t head, lastTime, count, first, i;
+    uint16_t size;
+    sbtn_Event_t* events;
+    unsigned eventNum = 0;
+    uint32_t high = 0, rel = 0;
+    int started = 0;
+    uint16_t buttons[SBTN_MAX_BUTTONS];
+    unsigned buttonNum = 0;
+    int arg;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (strcmp(argv[arg], "-n") == 0 && arg + 1 < argc) {
+            if (sbtn_ParseName(argv[++arg]) != 0) {
+                fprintf(stderr, "bad name: %s\n", argv[arg]);
+                return 2;
+            }
+        } else if (path == NULL) {
+            path = argv[arg];
+        } else {
+            path = NULL;
+            break;
+        }
+    }
+    if (path == NULL) {
+        fprintf(stderr, "usage: %s [-n 0xADDR=Name]... trace.bin\n", argv[0]);
+        return 2;
+    }
+
+    file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        return 1;
+    }
+    fseek(file, 0, SEEK_END);
+    length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    dump = (uint8_t*)malloc((size_t)(length > 0 ? length : 1));
+    if (dump == NULL || fread(dump, 1, (size_t)length, file) != (size_t)length) {
+        fprintf(stderr, "%s: read error\n", path);
+        return 1;
+    }
+    fclose(file);
+
+    if (length < SBTN_TRACE_HEADER_SIZE || sbtn_Read32(dump) != SBTN_TRACE_MAGIC) {
+        fprintf(stderr, "%s: not a Simple-Button trace dump\n", path);
+        return 1;
+    }
+    size = sbtn_Read16(dump + 6);
+    head = sbtn_Read32(dump + 8);
+    lastTime = sbtn_Read32(dump + 12);
+    if (dump[4] != SBTN_TRACE_RECORD_SIZE || size == 0 || (size & (size - 1)) != 0
+        || length < SBTN_TRACE_HEADER_SIZE + (long)size * SBTN_TRACE_RECORD_SIZE) {
+        fprintf(stderr, "%s: bad trace header\n", path);
+        return 1;
+    }
+    sbtn_BuildStateNames(dump[5]);
+
+    count = (head < size) ? head : size;
+    first = head - count;
+    events = (sbtn_Event_t*)malloc(sizeof(sbtn_Event_t) * (count + 1));
+    if (events == NULL) {
+        return 1;
+    }
+
+    /* Relative times, the delta of the oldest record points to a lost one */
+    for (i = first; i != head; i++) {
+        const uint8_t* r = dump + SBTN_TRACE_HEADER_SIZE + (size_t)(i & (size - 1U)) * SBTN_TRACE_RECORD_SIZE;
+        const uint16_t delta = sbtn_Read16(r);
+
+        if (r[4] == SBTN_TRACE_KIND_TIME_HIGH) {
+            high = (uint32_t)delta << 16;
+            continue;
+        }
+        if (started) {
+            rel += high | delta;
+        }
+        started = 1;
+        high = 0;
+
+        events[eventNum].time = rel;
+        events[eventNum].button = sbtn_Read16(r + 2);
+        events[eventNum].kind = r[4];
+        events[eventNum].arg = r[5];
+        eventNum++;
+    }
+
+    /* The newest record was written at `lastTime` */
+    for (i = 0; i < eventNum; i++) {
+        events[i].time = lastTime - (rel - events[i].time);
+    }
+
+    printf("%lu records (%lu lost), tick %lu\n",
+        (unsigned long)count, (unsigned long)first, (unsigned long)lastTime);
+
+    for (i = 0; i < eventNum; i++) {
+        unsigned b;
+
+        for (b = 0; b < buttonNum && buttons[b] != events[i].button; b++) {
+        }
+        if (b == buttonNum && buttonNum < SBTN_MAX_BUTTONS) {
+            buttons[buttonNum++] = events[i].button;
+            sbtn_PrintButton(events + i, eventNum - i, events[i].button);
+        }
+    }
+
+    free(events);
+    free(dump);
+    return 0;
+}